@@ -0,0 +1,669 @@
+#include "Benchmark.h"
+#include "Graphics.h"
+#include "InputManager.h"
+#include "Logging.h"
+#include "OperatingSystem.h"
+#include "Sound.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <new>
+
+namespace
+{
+	std::atomic<uint64_t>& GetAllocationCounter()
+	{
+		static std::atomic<uint64_t> counter = 0;
+		return counter;
+	}
+}
+
+// every allocation in the benchmark goes through here,
+// so the hot path can be checked for per-tick allocations
+void* operator new(const size_t size)
+{
+	GetAllocationCounter().fetch_add(1, std::memory_order_relaxed);
+
+	void* const result = std::malloc(size ? size : 1);
+	if (!result)
+		throw std::bad_alloc();
+
+	return result;
+}
+
+void operator delete(void* const pointer) noexcept
+{
+	std::free(pointer);
+}
+
+void operator delete(void* const pointer, const size_t size) noexcept
+{
+	(void)size;
+	std::free(pointer);
+}
+
+namespace BlastOff
+{
+	BenchmarkArguments BenchmarkArguments::Parse(
+		const int argumentCount,
+		const char* const* const arguments
+	)
+	{
+		BenchmarkArguments result;
+
+		const auto parseCount =
+			[&](const string& value, uint64_t& destination)
+			{
+				try
+				{
+					destination = std::stoull(value);
+				}
+				catch (const std::exception& exception)
+				{
+					(void)exception;
+					result.unrecognized.push_back(value);
+				}
+			};
+
+		// the first argument is always the path to the executable
+		for (int index = 1; index < argumentCount; index++)
+		{
+			const string argument = arguments[index];
+			const bool hasValue = (index + 1) < argumentCount;
+
+			if (argument == "--headless")
+				result.isHeadless = true;
+			else if ((argument == "--ticks") && hasValue)
+				parseCount(arguments[++index], result.tickCount);
+			else if ((argument == "--warmup") && hasValue)
+				parseCount(arguments[++index], result.warmupTickCount);
+			else if ((argument == "--seed") && hasValue)
+				parseCount(arguments[++index], result.seed);
+			else if ((argument == "--scenario") && hasValue)
+				result.scenarioName = arguments[++index];
+			else if ((argument == "--input") && hasValue)
+				result.inputPath = arguments[++index];
+			else if ((argument == "--output") && hasValue)
+				result.outputPath = arguments[++index];
+			else
+				result.unrecognized.push_back(argument);
+		}
+		return result;
+	}
+
+
+	BenchmarkRunner::BenchmarkRunner(const BenchmarkArguments& arguments) :
+		m_Arguments(arguments)
+	{
+		const auto logUnrecognizedArguments =
+			[this]()
+			{
+				for (const string& argument : m_Arguments.unrecognized)
+				{
+					const string message =
+					{
+						"Ignoring unrecognized argument \"" + argument + "\"."
+					};
+					Logging::Log(message.c_str());
+				}
+			};
+
+		const auto initializeWindow =
+			[this]()
+			{
+				if (m_Arguments.isHeadless)
+					return;
+
+				// the results should never depend on the size of the screen
+				const Vector2i size = c_Config.CalculateHeadlessWindowSize();
+				const string title = c_Config.CalculateBuildString();
+
+				SetConfigFlags(FLAG_WINDOW_HIDDEN);
+				m_Window = std::make_unique<RayWindow>(size, title, false);
+				m_Window->Update();
+			};
+
+		const auto loadFont =
+			[this]()
+			{
+				const string& fontFace = c_Config.GetFontFace();
+				const string fontPath = GetFontPath(fontFace.c_str(), "ttf");
+				const int fontSize = c_Config.GetFontRenderSize();
+
+				constexpr int codepointCount = 0;
+				if (m_Arguments.isHeadless)
+				{
+					m_Font = TextTextureLoader::LoadHeadlessFont(
+						fontPath.c_str(),
+						fontSize
+					);
+				}
+				else
+				{
+					m_Font = LoadFontEx(
+						fontPath.c_str(),
+						fontSize,
+						nullptr,
+						codepointCount
+					);
+				}
+			};
+
+		const auto loadInput =
+			[this]()
+			{
+				if (m_Arguments.inputPath)
+				{
+					const string& path = *m_Arguments.inputPath;
+					m_Input = InputRecording::LoadFromPath(path.c_str());
+				}
+				if (!m_Input)
+				{
+					const uint64_t tickCount =
+					{
+						m_Arguments.warmupTickCount + m_Arguments.tickCount
+					};
+					m_Input = CreateDefaultFlight(tickCount, m_Arguments.seed);
+				}
+			};
+
+		Logging::Initialize(&c_Config);
+		logUnrecognizedArguments();
+
+		// keeps raylib's own logging out of the report
+		SetTraceLogLevel(LOG_WARNING);
+
+		initializeWindow();
+		loadFont();
+		loadInput();
+	}
+
+	BenchmarkRunner::~BenchmarkRunner()
+	{
+		if (m_Font.texture.id)
+			UnloadFont(m_Font);
+		else
+			TextTextureLoader::UnloadHeadlessFont(m_Font);
+	}
+
+	void BenchmarkRunner::Run()
+	{
+		const vector<BenchmarkScenario> scenarios = CreateScenarios();
+
+		for (const BenchmarkScenario& scenario : scenarios)
+		{
+			const optional<string>& filter = m_Arguments.scenarioName;
+			if (filter && (*filter != scenario.name))
+				continue;
+
+			m_Results.push_back(RunScenario(scenario));
+		}
+
+		if (m_Results.empty())
+		{
+			const char* const message =
+			{
+				"BenchmarkRunner::Run() failed: "
+				"No scenario matches the given name."
+			};
+			Logging::LogWarning(message);
+		}
+	}
+
+	bool BenchmarkRunner::WriteReport() const
+	{
+		const string json = ToJSON();
+		if (!m_Arguments.outputPath)
+		{
+			std::printf("%s\n", json.c_str());
+			return true;
+		}
+
+		const string& path = *m_Arguments.outputPath;
+		std::ofstream output(path);
+		output << json;
+		if (!output)
+		{
+			const string message =
+			{
+				"BenchmarkRunner::WriteReport() failed: "
+				"Unable to write json to path \"" + path + "\"."
+			};
+			Logging::LogWarning(message.c_str());
+			return false;
+		}
+		return true;
+	}
+
+	vector<BenchmarkScenario> BenchmarkRunner::CreateScenarios()
+	{
+		const GamePopulation defaultPopulation = GamePopulation::Default();
+
+		// ten times as many of every powerup
+		constexpr size_t powerupMultiplier = 10;
+		GamePopulation powerupHeavyPopulation = defaultPopulation;
+		powerupHeavyPopulation.speedUpPowerupCount =
+		{
+			SpeedUpPowerup::c_Count * powerupMultiplier
+		};
+		powerupHeavyPopulation.fuelUpPowerupCount =
+		{
+			FuelUpPowerup::c_Count * powerupMultiplier
+		};
+		powerupHeavyPopulation.downforcePowerupCount =
+		{
+			DownforcePowerup::c_Count * powerupMultiplier
+		};
+
+		GamePopulation floatingPlatformPopulation = defaultPopulation;
+		floatingPlatformPopulation.floatingPlatformCount =
+		{
+			FloatingPlatform::c_Count
+		};
+
+		return
+		{
+			{ "default", false, defaultPopulation },
+			{ "cutscene", true, defaultPopulation },
+			{ "powerup-heavy", false, powerupHeavyPopulation },
+			{ "floating-platforms", false, floatingPlatformPopulation }
+		};
+	}
+
+	InputRecording BenchmarkRunner::CreateDefaultFlight(
+		const uint64_t tickCount, 
+		const uint64_t seed
+	)
+	{
+		// holds space the whole time, while steering
+		// gently from side to side, far above the player
+		constexpr float targetHeight = 10'000;
+		constexpr float swayWidth = targetHeight / 5;
+		constexpr float swayPeriod = 240;
+
+		InputRecording result;
+		result.seed = seed;
+		const uint64_t spaceBit = result.FindOrAddKey(KEY_SPACE);
+
+		result.ticks.resize(tickCount);
+		for (uint64_t tick = 0; tick < tickCount; tick++)
+		{
+			const float phase = (tick / swayPeriod) * c_Pi * 2;
+
+			InputSnapshot& snapshot = result.ticks.at(tick);
+			snapshot.keysDown = spaceBit;
+			snapshot.mousePosition = { sinf(phase) * swayWidth, targetHeight };
+		}
+		return result;
+	}
+
+	ScenarioResult BenchmarkRunner::RunScenario
+		(const BenchmarkScenario& scenario)
+	{
+		const bool isHeadless = m_Arguments.isHeadless;
+		const uint64_t tickCount = m_Arguments.tickCount;
+		const uint64_t totalTickCount = m_Arguments.warmupTickCount + tickCount;
+
+		ScenarioResult result = {};
+		result.name = scenario.name;
+		result.tickCount = tickCount;
+
+		AssetManager assetManager = {};
+		ImageTextureLoader imageTextureLoader(&assetManager, isHeadless);
+		imageTextureLoader.BuildAtlases();
+		TextTextureLoader textTextureLoader(&m_Font, isHeadless);
+
+		// the audio device is never opened
+		SoundLoader soundLoader(&assetManager, true);
+		const bool isMuted = true;
+
+		const Vector2i headlessWindowSize =
+		{
+			c_Config.CalculateHeadlessWindowSize()
+		};
+		const Vector2i windowPosition = Vector2i::Zero();
+		const Vector2i* const windowSize =
+		{
+			m_Window ? m_Window->GetSize() : &headlessWindowSize
+		};
+
+		// only the cutscene relies on these,
+		// since the playable game owns its own
+		Vector2f cameraPosition = Vector2f::Zero();
+		CoordinateTransformer coordTransformer(
+			windowSize,
+			&windowPosition,
+			&cameraPosition
+		);
+		coordTransformer.Update();
+		CameraEmpty cameraEmpty(&coordTransformer, &c_Config, &cameraPosition);
+
+		bool shouldReset = false;
+		unique_ptr<Game> game = nullptr;
+
+		// the cutscene moves on to a new seed every reset,
+		// while a replay has to keep the one it was recorded with
+		const auto chooseSeed =
+			[&, this]() -> uint64_t
+			{
+				if (scenario.isCutscene)
+					return m_Arguments.seed + result.resetCount;
+
+				return m_Input->seed;
+			};
+
+		const auto createGame =
+			[&, this]()
+			{
+				const auto resetCallback =
+					[&]()
+					{
+						shouldReset = true;
+					};
+				const auto emptyCallback = []() {};
+				const uint64_t seed = chooseSeed();
+
+				if (scenario.isCutscene)
+				{
+					cameraPosition = Vector2f::Zero();
+					cameraEmpty.Update();
+
+					game = std::make_unique<Cutscene>(
+						&c_Config,
+						&coordTransformer,
+						&cameraEmpty,
+						&imageTextureLoader,
+						&textTextureLoader,
+						&cameraPosition,
+						nullptr,
+						resetCallback,
+						scenario.population,
+						seed
+					);
+					return;
+				}
+
+				const auto inputManagerFactory =
+					[this](const CoordinateTransformer* const transformer)
+						-> unique_ptr<InputManager>
+					{
+						return std::make_unique<ReplayInputManager>(
+							transformer,
+							&(*m_Input)
+						);
+					};
+
+				game = std::make_unique<PlayableGame>(
+					&isMuted,
+					&c_Config,
+					&imageTextureLoader,
+					&textTextureLoader,
+					&soundLoader,
+					emptyCallback,
+					resetCallback,
+					emptyCallback,
+					&windowPosition,
+					windowSize,
+					inputManagerFactory,
+					scenario.population,
+					seed
+				);
+			};
+
+		const auto updateGame =
+			[&]()
+			{
+				if (scenario.isCutscene)
+				{
+					coordTransformer.Update();
+					game->Update();
+					cameraEmpty.Update();
+				}
+				else
+					game->Update();
+			};
+
+		// flushed inside the timed draw, since that's where the GPU work is
+		RenderQueue renderQueue = {};
+
+		const auto drawGame =
+			[&]()
+			{
+				const Colour4i voidColour = c_Config.GetVoidColour();
+				ClearBackground(voidColour.ToRayColour());
+
+				game->Draw(&renderQueue);
+				renderQueue.Flush();
+			};
+
+		const auto summarize =
+			[](vector<uint64_t>& samples, const uint64_t allocationCount)
+				-> TimingSummary
+			{
+				std::sort(samples.begin(), samples.end());
+
+				const auto calculatePercentile =
+					[&](const float percentile) -> uint64_t
+					{
+						const float rank = ceilf(percentile * samples.size());
+						const size_t index = std::max((size_t)rank, (size_t)1) - 1;
+						return samples.at(std::min(index, samples.size() - 1));
+					};
+
+				TimingSummary summary = {};
+				if (samples.empty())
+					return summary;
+
+				uint64_t sum = 0;
+				for (const uint64_t sample : samples)
+					sum += sample;
+
+				summary.min = samples.front();
+				summary.median = calculatePercentile(0.5f);
+				summary.p99 = calculatePercentile(0.99f);
+				summary.max = samples.back();
+				summary.mean = sum / (float)samples.size();
+				summary.allocationsPerTick =
+				{
+					allocationCount / (float)samples.size()
+				};
+				return summary;
+			};
+
+		const auto measure =
+			[](const auto& work, uint64_t* const allocationCount)
+				-> uint64_t
+			{
+				std::atomic<uint64_t>& counter = GetAllocationCounter();
+				const uint64_t allocationsBefore = counter.load();
+				const auto start = high_resolution_clock::now();
+
+				work();
+
+				const auto duration = high_resolution_clock::now() - start;
+				*allocationCount += counter.load() - allocationsBefore;
+				return duration_cast<nanoseconds>(duration).count();
+			};
+
+		vector<uint64_t> updateSamples = {};
+		vector<uint64_t> drawSamples = {};
+		updateSamples.reserve(tickCount);
+		drawSamples.reserve(tickCount);
+
+		vector<uint64_t> resetSamples = {};
+
+		uint64_t updateAllocations = 0;
+		uint64_t drawAllocations = 0;
+		uint64_t resetAllocations = 0;
+
+		// in place, the same way Program resets
+		const auto resetGame =
+			[&]()
+			{
+				if (scenario.isCutscene)
+				{
+					cameraPosition = Vector2f::Zero();
+					cameraEmpty.Update();
+				}
+				game->Reset(chooseSeed());
+			};
+
+		FrametimeStatistics frametimeStatistics(c_Config.GetTargetFrametime());
+
+		createGame();
+		for (uint64_t tick = 0; tick < totalTickCount; tick++)
+		{
+			const bool isWarmup = tick < m_Arguments.warmupTickCount;
+
+			FrameSample frame = {};
+			frame.state = ProgramState::Game;
+
+			uint64_t allocationCount = 0;
+			frame.update = measure(updateGame, &allocationCount);
+			if (!isWarmup)
+			{
+				updateSamples.push_back(frame.update);
+				updateAllocations += allocationCount;
+			}
+
+			if (!isHeadless)
+			{
+				// EndDrawing() is left out, since it waits on the GPU
+				BeginDrawing();
+
+				allocationCount = 0;
+				frame.draw = measure(drawGame, &allocationCount);
+				if (!isWarmup)
+				{
+					drawSamples.push_back(frame.draw);
+					drawAllocations += allocationCount;
+				}
+
+				EndDrawing();
+			}
+
+			if (!isWarmup)
+			{
+				frame.frame = frame.update + frame.draw;
+				frametimeStatistics.AddFrame(frame);
+			}
+
+			if (shouldReset)
+			{
+				shouldReset = false;
+				result.resetCount++;
+
+				allocationCount = 0;
+				const uint64_t reset = measure(resetGame, &allocationCount);
+				if (!isWarmup)
+				{
+					resetSamples.push_back(reset);
+					resetAllocations += allocationCount;
+				}
+			}
+		}
+
+		result.update = summarize(updateSamples, updateAllocations);
+		if (!isHeadless)
+			result.draw = summarize(drawSamples, drawAllocations);
+		if (!resetSamples.empty())
+			result.reset = summarize(resetSamples, resetAllocations);
+
+		result.frametimes = frametimeStatistics.CalculateSessionReport();
+		return result;
+	}
+
+	string BenchmarkRunner::ToJSON() const
+	{
+		StringBuffer buffer;
+		PrettyWriter<StringBuffer> writer(buffer);
+
+		const auto writeTiming =
+			[&](const TimingSummary& timing, const char* const perKey)
+			{
+				writer.StartObject();
+				writer.Key("minNs");
+				writer.Uint64(timing.min);
+				writer.Key("medianNs");
+				writer.Uint64(timing.median);
+				writer.Key("p99Ns");
+				writer.Uint64(timing.p99);
+				writer.Key("maxNs");
+				writer.Uint64(timing.max);
+				writer.Key("meanNs");
+				writer.Double(timing.mean);
+				writer.Key(perKey);
+				writer.Double(timing.allocationsPerTick);
+				writer.EndObject();
+			};
+
+		const auto writeFrametimes =
+			[&](const FrametimeReport& report)
+			{
+				writer.StartObject();
+				writer.Key("frameP95Ms");
+				writer.Double(report.frame.p95);
+				writer.Key("overBudgetTicks");
+				writer.Uint64(report.overBudgetCount);
+				writer.Key("hitches");
+				writer.Uint64(report.hitchCount);
+				writer.Key("longestTickMs");
+				writer.Double(report.longestHitch);
+				writer.Key("longestTick");
+				writer.Uint64(report.longestHitchFrame);
+				writer.EndObject();
+			};
+
+		const auto writeScenario =
+			[&](const ScenarioResult& scenario)
+			{
+				writer.StartObject();
+				writer.Key("name");
+				writer.String(scenario.name);
+				writer.Key("ticks");
+				writer.Uint64(scenario.tickCount);
+				writer.Key("resets");
+				writer.Uint64(scenario.resetCount);
+				writer.Key("update");
+				writeTiming(scenario.update, "allocationsPerTick");
+				writer.Key("draw");
+				if (scenario.draw)
+					writeTiming(*scenario.draw, "allocationsPerTick");
+				else
+					writer.Null();
+				writer.Key("reset");
+				if (scenario.reset)
+					writeTiming(*scenario.reset, "allocationsPerReset");
+				else
+					writer.Null();
+				writer.Key("frametimes");
+				writeFrametimes(scenario.frametimes);
+				writer.EndObject();
+			};
+
+		const string build = c_Config.CalculateBuildString();
+
+		writer.StartObject();
+		writer.Key("build");
+		writer.String(build.c_str());
+		writer.Key("seed");
+		writer.Uint64(m_Arguments.seed);
+		writer.Key("inputSeed");
+		writer.Uint64(m_Input->seed);
+		writer.Key("warmupTicks");
+		writer.Uint64(m_Arguments.warmupTickCount);
+		writer.Key("headless");
+		writer.Bool(m_Arguments.isHeadless);
+
+		writer.Key("scenarios");
+		writer.StartArray();
+		for (const ScenarioResult& scenario : m_Results)
+			writeScenario(scenario);
+		writer.EndArray();
+
+		writer.EndObject();
+		return buffer.GetString();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,108 @@
+#pragma once
+
+#include "Utils.h"
+#include "Game.h"
+#include "FrametimeStatistics.h"
+#include "InputRecording.h"
+#include "ProgramConstants.h"
+
+#include "raylib.h"
+
+namespace BlastOff
+{
+	struct BenchmarkArguments
+	{
+		// without a window, nothing can be drawn,
+		// so only Update() gets measured
+		bool isHeadless = false;
+
+		uint64_t tickCount = 3600;
+		uint64_t warmupTickCount = 120;
+		uint64_t seed = 0;
+
+		// runs every scenario if unset
+		optional<string> scenarioName = std::nullopt;
+
+		// a recording to drive the playable scenarios with,
+		// instead of the built-in flight
+		optional<string> inputPath = std::nullopt;
+
+		// prints to stdout if unset
+		optional<string> outputPath = std::nullopt;
+
+		vector<string> unrecognized = {};
+
+		static BenchmarkArguments Parse(
+			const int argumentCount,
+			const char* const* const arguments
+		);
+	};
+
+	struct BenchmarkScenario
+	{
+		const char* name = nullptr;
+		bool isCutscene = false;
+		GamePopulation population = {};
+	};
+
+	// in nanoseconds
+	struct TimingSummary
+	{
+		uint64_t min = 0;
+		uint64_t median = 0;
+		uint64_t p99 = 0;
+		uint64_t max = 0;
+		float mean = 0;
+		float allocationsPerTick = 0;
+	};
+
+	struct ScenarioResult
+	{
+		const char* name = nullptr;
+		uint64_t tickCount = 0;
+		uint64_t resetCount = 0;
+
+		TimingSummary update = {};
+		optional<TimingSummary> draw = std::nullopt;
+
+		// one sample per reset, so its allocations are per reset too.
+		// empty if the game never reset outside the warmup
+		optional<TimingSummary> reset = std::nullopt;
+
+		// each tick's update and draw count as one frame,
+		// since nothing waits on the GPU or the framerate
+		FrametimeReport frametimes = {};
+	};
+
+	// runs each scenario for a fixed number of ticks,
+	// with a fixed seed and fixed input,
+	// so two builds can be compared tick for tick
+	struct BenchmarkRunner
+	{
+		BenchmarkRunner(const BenchmarkArguments& arguments);
+		~BenchmarkRunner();
+
+		void Run();
+		bool WriteReport() const;
+
+	private:
+		static const inline ProgramConstants c_Config;
+
+		static vector<BenchmarkScenario> CreateScenarios();
+		static InputRecording CreateDefaultFlight(
+			const uint64_t tickCount, 
+			const uint64_t seed
+		);
+
+		const BenchmarkArguments m_Arguments;
+
+		unique_ptr<RayWindow> m_Window = nullptr;
+		Font m_Font = { 0 };
+		optional<InputRecording> m_Input = std::nullopt;
+
+		vector<ScenarioResult> m_Results = {};
+
+		ScenarioResult RunScenario(const BenchmarkScenario& scenario);
+		string ToJSON() const;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,14 @@
+#include "Benchmark.h"
+
+int main(int argc, char** argv)
+{
+    const BlastOff::BenchmarkArguments arguments = 
+    {
+        BlastOff::BenchmarkArguments::Parse(argc, argv)
+    };
+
+    BlastOff::BenchmarkRunner runner(arguments);
+    runner.Run();
+
+    return runner.WriteReport() ? 0 : 1;
+}
\ No newline at end of file
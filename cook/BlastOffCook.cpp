@@ -0,0 +1,14 @@
+#include "Cooker.h"
+
+int main(int argc, char** argv)
+{
+    const BlastOff::CookArguments arguments = 
+    {
+        BlastOff::CookArguments::Parse(argc, argv)
+    };
+
+    BlastOff::Cooker cooker(arguments);
+    cooker.Run();
+
+    return cooker.WriteArchive() ? 0 : 1;
+}
\ No newline at end of file
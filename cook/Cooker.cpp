@@ -0,0 +1,345 @@
+#include "Cooker.h"
+#include "Logging.h"
+#include "OperatingSystem.h"
+
+#include "raylib.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <format>
+#include <fstream>
+
+namespace BlastOff
+{
+	namespace
+	{
+		void OnCookingError(const char* const function, const string& path)
+		{
+			const string message = std::format(
+				"Cooker::{}() failed: "
+				"Unable to cook the file at path \"{}\".",
+				function,
+				path
+			);
+			Logging::LogWarning(message.c_str());
+		}
+	}
+
+	CookArguments CookArguments::Parse(
+		const int argumentCount,
+		const char* const* const arguments
+	)
+	{
+		CookArguments result;
+
+		// the first argument is always the path to the executable
+		for (int index = 1; index < argumentCount; index++)
+		{
+			const string argument = arguments[index];
+			const bool hasValue = (index + 1) < argumentCount;
+
+			if ((argument == "--resources") && hasValue)
+				result.resourceDirectory = arguments[++index];
+			else if ((argument == "--output") && hasValue)
+				result.outputPath = arguments[++index];
+			else
+				result.unrecognized.push_back(argument);
+		}
+
+		// so paths can be appended straight onto it
+		string& directory = result.resourceDirectory;
+		if (!directory.empty() && !directory.ends_with('/'))
+			directory += '/';
+
+		return result;
+	}
+
+
+	Cooker::Cooker(const CookArguments& arguments) :
+		m_Arguments(arguments)
+	{
+		const auto logUnrecognizedArguments =
+			[this]()
+			{
+				for (const string& argument : m_Arguments.unrecognized)
+				{
+					const string message =
+					{
+						"Ignoring unrecognized argument \"" + argument + "\"."
+					};
+					Logging::Log(message.c_str());
+				}
+			};
+
+		Logging::Initialize(&c_Config);
+		logUnrecognizedArguments();
+
+		// one line per file would bury any failures
+		SetTraceLogLevel(LOG_WARNING);
+	}
+
+	void Cooker::Run()
+	{
+		const auto cookAll =
+			[this](const vector<string>& paths, const auto& cook)
+			{
+				for (const string& path : paths)
+				{
+					optional<CookedAsset> asset = cook(path);
+					if (asset)
+						m_Assets.push_back(std::move(*asset));
+					else
+						m_FailureCount++;
+				}
+			};
+
+		cookAll(
+			FindPaths("png/", ".png"),
+			[this](const string& path) { return CookImage(path); }
+		);
+		cookAll(
+			FindPaths("wav/", ".wav"),
+			[this](const string& path) { return CookWave(path); }
+		);
+		cookAll(
+			FindPaths("ogg/", ".ogg"),
+			[this](const string& path) { return CookFile(path); }
+		);
+		cookAll(
+			FindPaths("ttf/", ".ttf"),
+			[this](const string& path) { return CookFile(path); }
+		);
+
+		// the archive is searched by path, so it has to be sorted by it
+		std::sort(
+			m_Assets.begin(),
+			m_Assets.end(),
+			[](const CookedAsset& left, const CookedAsset& right)
+			{
+				return left.path < right.path;
+			}
+		);
+
+		size_t byteSize = 0;
+		for (const CookedAsset& asset : m_Assets)
+			byteSize += asset.data.size();
+
+		const string message = std::format(
+			"Cooked {} assets, {:.2f} MiB in total.",
+			m_Assets.size(),
+			byteSize / (1024.0f * 1024.0f)
+		);
+		Logging::Log(message.c_str());
+	}
+
+	bool Cooker::WriteArchive() const
+	{
+		const string path =
+		{
+			m_Arguments.outputPath ?
+				*m_Arguments.outputPath :
+				AssetArchive::c_DefaultPath
+		};
+
+		// a partial archive would hide the files it's missing
+		if (m_FailureCount)
+		{
+			const string message = std::format(
+				"Cooker::WriteArchive() failed: "
+				"{} files couldn't be cooked, so \"{}\" was left alone.",
+				m_FailureCount,
+				path
+			);
+			Logging::LogWarning(message.c_str());
+			return false;
+		}
+
+		const auto alignData =
+			[](const uint64_t offset) -> uint64_t
+			{
+				const uint64_t alignment = AssetArchive::c_DataAlignment;
+				return ((offset + alignment - 1) / alignment) * alignment;
+			};
+
+		ArchiveHeader header = {};
+		header.magic = AssetArchive::c_Magic;
+		header.version = AssetArchive::c_Version;
+		header.entryCount = (uint32_t)m_Assets.size();
+		header.pathsOffset =
+		{
+			sizeof(header) + m_Assets.size() * sizeof(ArchiveEntry)
+		};
+
+		string paths = "";
+		vector<ArchiveEntry> entries = {};
+		entries.reserve(m_Assets.size());
+		for (const CookedAsset& asset : m_Assets)
+		{
+			ArchiveEntry entry = asset.entry;
+			entry.pathOffset = (uint32_t)paths.size();
+			entry.pathLength = (uint32_t)asset.path.size();
+			entries.push_back(entry);
+
+			paths += asset.path;
+		}
+		header.pathsSize = paths.size();
+
+		// every entry's data starts aligned, relative to the mapping
+		uint64_t offset = header.pathsOffset + header.pathsSize;
+		for (size_t index = 0; index < entries.size(); index++)
+		{
+			offset = alignData(offset);
+			entries[index].dataOffset = offset;
+			entries[index].dataSize = m_Assets[index].data.size();
+			offset += entries[index].dataSize;
+		}
+
+		std::ofstream output(path, std::ios::binary);
+		output.write((const char*)&header, sizeof(header));
+		output.write(
+			(const char*)entries.data(),
+			entries.size() * sizeof(ArchiveEntry)
+		);
+		output.write(paths.data(), paths.size());
+
+		uint64_t position = header.pathsOffset + header.pathsSize;
+		for (size_t index = 0; index < entries.size(); index++)
+		{
+			const array<char, 16> padding = { 0 };
+			const uint64_t paddingSize = entries[index].dataOffset - position;
+			output.write(padding.data(), paddingSize);
+
+			const vector<byte>& data = m_Assets[index].data;
+			output.write((const char*)data.data(), data.size());
+			position = entries[index].dataOffset + data.size();
+		}
+
+		if (!output)
+		{
+			const string message =
+			{
+				"Cooker::WriteArchive() failed: "
+				"Unable to write to path \"" + path + "\"."
+			};
+			Logging::LogWarning(message.c_str());
+			return false;
+		}
+
+		const string message = std::format(
+			"Wrote {} entries to \"{}\".",
+			entries.size(),
+			path
+		);
+		Logging::Log(message.c_str());
+		return true;
+	}
+
+	vector<string> Cooker::FindPaths(
+		const char* const directory,
+		const char* const extension
+	) const
+	{
+		namespace fs = std::filesystem;
+
+		const fs::path resourceDirectory = m_Arguments.resourceDirectory;
+
+		vector<string> result = {};
+		std::error_code error;
+		for (const fs::directory_entry& entry :
+			fs::recursive_directory_iterator(
+				resourceDirectory / directory,
+				error
+			))
+		{
+			if (entry.path().extension() != extension)
+				continue;
+
+			const fs::path relative =
+			{
+				fs::relative(entry.path(), resourceDirectory)
+			};
+			result.push_back(relative.generic_string());
+		}
+
+		std::sort(result.begin(), result.end());
+		return result;
+	}
+
+	optional<CookedAsset> Cooker::CookImage(const string& path) const
+	{
+		const string loadingPath = m_Arguments.resourceDirectory + path;
+		Image image = LoadImage(loadingPath.c_str());
+		if (!image.data)
+		{
+			OnCookingError("CookImage", loadingPath);
+			return std::nullopt;
+		}
+
+		// the same format the game converts to when it decodes a PNG
+		ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+		const size_t byteSize = (size_t)image.width * image.height * 4;
+		const byte* const pixels = (const byte*)image.data;
+
+		CookedAsset result = {};
+		result.path = path;
+		result.entry.type = ArchiveEntryType::RawImage;
+		result.entry.width = (uint32_t)image.width;
+		result.entry.height = (uint32_t)image.height;
+		result.data.assign(pixels, pixels + byteSize);
+
+		UnloadImage(image);
+		return result;
+	}
+
+	optional<CookedAsset> Cooker::CookWave(const string& path) const
+	{
+		const string loadingPath = m_Arguments.resourceDirectory + path;
+		const Wave wave = LoadWave(loadingPath.c_str());
+		if (!wave.frameCount)
+		{
+			OnCookingError("CookWave", loadingPath);
+			return std::nullopt;
+		}
+
+		const size_t byteSize =
+		{
+			(size_t)wave.frameCount * wave.channels * wave.sampleSize / 8
+		};
+		const byte* const samples = (const byte*)wave.data;
+
+		CookedAsset result = {};
+		result.path = path;
+		result.entry.type = ArchiveEntryType::RawWave;
+		result.entry.frameCount = wave.frameCount;
+		result.entry.sampleRate = wave.sampleRate;
+		result.entry.sampleSize = wave.sampleSize;
+		result.entry.channels = wave.channels;
+		result.data.assign(samples, samples + byteSize);
+
+		UnloadWave(wave);
+		return result;
+	}
+
+	optional<CookedAsset> Cooker::CookFile(const string& path) const
+	{
+		const string loadingPath = m_Arguments.resourceDirectory + path;
+		const unique_ptr<MappedFile> file =
+		{
+			MappedFile::Open(loadingPath.c_str())
+		};
+		if (!file)
+		{
+			OnCookingError("CookFile", loadingPath);
+			return std::nullopt;
+		}
+
+		const byte* const data = file->GetData();
+
+		CookedAsset result = {};
+		result.path = path;
+		result.entry.type = ArchiveEntryType::File;
+		result.data.assign(data, data + file->GetSize());
+		return result;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "Utils.h"
+#include "AssetArchive.h"
+#include "ProgramConstants.h"
+
+namespace BlastOff
+{
+	struct CookArguments
+	{
+		// holds png/, wav/, ogg/ and ttf/
+		string resourceDirectory = "resource/";
+
+		// where the game looks for it if unset
+		optional<string> outputPath = std::nullopt;
+
+		vector<string> unrecognized = {};
+
+		static CookArguments Parse(
+			const int argumentCount,
+			const char* const* const arguments
+		);
+	};
+
+	// one asset, already in the form the game will use it in
+	struct CookedAsset
+	{
+		// relative to the resource directory, such as "png/ui/bar.png"
+		string path = "";
+
+		// everything but where it ends up in the archive
+		ArchiveEntry entry = {};
+		vector<byte> data = {};
+	};
+
+	// decodes every image and sound ahead of time, so the game
+	// never has to, and packs them with everything else into one archive
+	struct Cooker
+	{
+		Cooker(const CookArguments& arguments);
+
+		void Run();
+
+		// returns false if anything couldn't be cooked, 
+		// or the archive couldn't be written
+		bool WriteArchive() const;
+
+	private:
+		static const inline ProgramConstants c_Config;
+
+		CookArguments m_Arguments = {};
+
+		vector<CookedAsset> m_Assets = {};
+		size_t m_FailureCount = 0;
+
+		// every file under the directory with the extension,
+		// relative to the resource directory, and sorted
+		vector<string> FindPaths(
+			const char* const directory, 
+			const char* const extension
+		) const;
+
+		// PNGs are stored as raw RGBA, so they can be uploaded in place
+		optional<CookedAsset> CookImage(const string& path) const;
+
+		// WAVs are stored as raw samples, for the same reason
+		optional<CookedAsset> CookWave(const string& path) const;
+
+		// music is streamed and fonts are rasterized at load,
+		// so both are stored as they are
+		optional<CookedAsset> CookFile(const string& path) const;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,30 @@
+#include "Arena.h"
+
+namespace BlastOff
+{
+	Arena::Arena(const size_t initialSize) :
+		m_Resource(initialSize),
+		m_Destructors(&m_Resource)
+	{
+
+	}
+
+	Arena::~Arena()
+	{
+		// objects made later may point at earlier ones, 
+		// so they're destroyed first, like members of a struct
+		for (size_t index = m_Destructors.size(); index > 0; index--)
+		{
+			const Destructor& destructor = m_Destructors[index - 1];
+			destructor.destroy(destructor.object);
+		}
+
+		// the memory itself goes back all at once,
+		// when the resource is destroyed
+	}
+
+	std::pmr::memory_resource* Arena::GetResource()
+	{
+		return &m_Resource;
+	}
+}
\ No newline at end of file
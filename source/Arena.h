@@ -0,0 +1,62 @@
+#pragma once
+
+#include "Utils.h"
+
+#include <memory_resource>
+
+namespace BlastOff
+{
+	// a vector whose elements live wherever its resource says,
+	// which for the game's objects is its arena
+	template <typename Type>
+	using ArenaVector = std::pmr::vector<Type>;
+
+	// hands out memory from a few large blocks, one after the other,
+	// and only gives it back once the arena is destroyed.
+	// anything made with Create() is destroyed then too, newest first
+	struct Arena
+	{
+		Arena(const size_t initialSize);
+		~Arena();
+
+		Arena(const Arena& other) = delete;
+		Arena& operator=(const Arena& other) = delete;
+
+		template <typename Type, typename... Arguments>
+		Type* Create(Arguments&&... arguments)
+		{
+			void* const memory = 
+			{
+				m_Resource.allocate(sizeof(Type), alignof(Type))
+			};
+			Type* const result =
+			{
+				new (memory) Type(std::forward<Arguments>(arguments)...)
+			};
+
+			if constexpr (!std::is_trivially_destructible_v<Type>)
+			{
+				const auto destroy =
+					[](void* const object)
+					{
+						((Type*)object)->~Type();
+					};
+				m_Destructors.push_back({ result, destroy });
+			}
+			return result;
+		}
+
+		// for containers that should allocate from the arena
+		std::pmr::memory_resource* GetResource();
+
+	private:
+		struct Destructor
+		{
+			void* object = nullptr;
+			void (*destroy)(void* const object) = nullptr;
+		};
+
+		std::pmr::monotonic_buffer_resource m_Resource;
+		ArenaVector<Destructor> m_Destructors;
+	};
+}
\ No newline at end of file
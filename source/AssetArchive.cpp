@@ -0,0 +1,161 @@
+#include "AssetArchive.h"
+#include "Logging.h"
+
+#include <algorithm>
+#include <cstring>
+#include <format>
+
+namespace BlastOff
+{
+	AssetArchive::AssetArchive(const char* const path) :
+		m_File(MappedFile::Open(path))
+	{
+		const auto logFailure =
+			[&](const char* const reason)
+			{
+				const string message = std::format(
+					"AssetArchive::AssetArchive() failed: "
+					"\"{}\" {}. Using loose files instead.",
+					path,
+					reason
+				);
+				Logging::LogWarning(message.c_str());
+			};
+
+		const auto isInBounds =
+			[this](const uint64_t offset, const uint64_t size) -> bool
+			{
+				const uint64_t fileSize = m_File->GetSize();
+				return (offset <= fileSize) && (size <= fileSize - offset);
+			};
+
+		// cooking is optional, so a missing archive is no surprise
+		if (!m_File)
+			return;
+
+		ArchiveHeader header = {};
+		if (m_File->GetSize() < sizeof(header))
+		{
+			logFailure("is too small to be an archive");
+			m_File = nullptr;
+			return;
+		}
+		std::memcpy(&header, m_File->GetData(), sizeof(header));
+
+		if (header.magic != c_Magic)
+		{
+			logFailure("isn't an archive");
+			m_File = nullptr;
+			return;
+		}
+		if (header.version != c_Version)
+		{
+			logFailure("was cooked for another version, so needs recooking");
+			m_File = nullptr;
+			return;
+		}
+
+		const uint64_t entriesSize = 
+		{
+			(uint64_t)header.entryCount * sizeof(ArchiveEntry)
+		};
+		const bool isIndexInBounds =
+		{
+			isInBounds(sizeof(header), entriesSize) &&
+			isInBounds(header.pathsOffset, header.pathsSize)
+		};
+		if (!isIndexInBounds)
+		{
+			logFailure("is truncated");
+			m_File = nullptr;
+			return;
+		}
+
+		const byte* const data = m_File->GetData();
+		m_Entries = (const ArchiveEntry*)(data + sizeof(header));
+		m_EntryCount = header.entryCount;
+		m_Paths = (const char*)(data + header.pathsOffset);
+
+		for (size_t index = 0; index < m_EntryCount; index++)
+		{
+			const ArchiveEntry& entry = m_Entries[index];
+			const uint64_t pathEnd = 
+			{
+				entry.pathOffset + (uint64_t)entry.pathLength
+			};
+			const bool isEntryInBounds =
+			{
+				isInBounds(entry.dataOffset, entry.dataSize) &&
+				(pathEnd <= header.pathsSize)
+			};
+			if (isEntryInBounds)
+				continue;
+
+			logFailure("is truncated");
+			m_File = nullptr;
+			m_Entries = nullptr;
+			m_EntryCount = 0;
+			m_Paths = nullptr;
+			return;
+		}
+
+		const string message = std::format(
+			"Mapped {} cooked assets from \"{}\".",
+			m_EntryCount,
+			path
+		);
+		Logging::Log(message.c_str());
+	}
+
+	bool AssetArchive::IsOpen() const
+	{
+		return m_File != nullptr;
+	}
+
+	optional<ArchivedAsset> AssetArchive::Find(const string_view path) const
+	{
+		const ArchiveEntry* const end = m_Entries + m_EntryCount;
+		const ArchiveEntry* const found = std::lower_bound(
+			m_Entries,
+			end,
+			path,
+			[this](const ArchiveEntry& entry, const string_view value)
+			{
+				return GetPath(entry) < value;
+			}
+		);
+		if ((found == end) || (GetPath(*found) != path))
+			return std::nullopt;
+
+		ArchivedAsset result = {};
+		result.entry = found;
+		result.data = m_File->GetData() + found->dataOffset;
+		return result;
+	}
+
+	vector<string> AssetArchive::FindPaths(const string_view directory) const
+	{
+		vector<string> result = {};
+		for (size_t index = 0; index < m_EntryCount; index++)
+		{
+			const string_view path = GetPath(m_Entries[index]);
+			if (path.starts_with(directory))
+				result.push_back(string(path.substr(directory.size())));
+		}
+		return result;
+	}
+
+	string_view AssetArchive::GetPath(const ArchiveEntry& entry) const
+	{
+		return string_view(m_Paths + entry.pathOffset, entry.pathLength);
+	}
+
+	const char* const AssetArchive::c_DefaultPath = "resource/assets.pack";
+
+	const array<char, 8> AssetArchive::c_Magic =
+	{
+		'B', 'L', 'S', 'T', 'P', 'A', 'C', 'K'
+	};
+	const uint32_t AssetArchive::c_Version = 1;
+	const uint64_t AssetArchive::c_DataAlignment = 16;
+}
\ No newline at end of file
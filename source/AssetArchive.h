@@ -0,0 +1,90 @@
+#pragma once
+
+#include "Utils.h"
+#include "Enums.h"
+#include "OperatingSystem.h"
+
+namespace BlastOff
+{
+	// the archive starts with this, then every entry, sorted by path,
+	// then every path, back to back, then every entry's data.
+	// all of it is little-endian
+	struct ArchiveHeader
+	{
+		array<char, 8> magic = {};
+		uint32_t version = 0;
+		uint32_t entryCount = 0;
+
+		uint64_t pathsOffset = 0;
+		uint64_t pathsSize = 0;
+	};
+
+	struct ArchiveEntry
+	{
+		uint64_t dataOffset = 0;
+		uint64_t dataSize = 0;
+
+		// into the paths, relative to the resource directory,
+		// such as "png/ui/barBacking.png"
+		uint32_t pathOffset = 0;
+		uint32_t pathLength = 0;
+
+		ArchiveEntryType type = ArchiveEntryType::File;
+
+		// only for RawImage
+		uint32_t width = 0;
+		uint32_t height = 0;
+
+		// only for RawWave
+		uint32_t frameCount = 0;
+		uint32_t sampleRate = 0;
+		uint32_t sampleSize = 0;
+		uint32_t channels = 0;
+
+		// fills what would otherwise be padding, 
+		// so cooking the same files always gives the same bytes
+		uint32_t reserved = 0;
+	};
+
+	// one entry, and its data, still inside the archive
+	struct ArchivedAsset
+	{
+		const ArchiveEntry* entry = nullptr;
+		const byte* data = nullptr;
+	};
+
+	// every asset, cooked ahead of time into one mapped file,
+	// so loading one is a lookup instead of an open, a read and a decode
+	struct AssetArchive
+	{
+		// an archive that can't be opened is left empty,
+		// so every lookup misses and the loose files get used instead
+		AssetArchive(const char* const path);
+
+		bool IsOpen() const;
+
+		// nothing in the archive ever changes, 
+		// so any thread can look things up
+		optional<ArchivedAsset> Find(const string_view path) const;
+
+		// every path under the directory, relative to it, and sorted
+		vector<string> FindPaths(const string_view directory) const;
+
+		static const char* const c_DefaultPath;
+
+		static const array<char, 8> c_Magic;
+		static const uint32_t c_Version;
+
+		// so the data can be used in place, whatever its type
+		static const uint64_t c_DataAlignment;
+
+	private:
+		unique_ptr<MappedFile> m_File = nullptr;
+
+		const ArchiveEntry* m_Entries = nullptr;
+		size_t m_EntryCount = 0;
+		const char* m_Paths = nullptr;
+
+		string_view GetPath(const ArchiveEntry& entry) const;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,217 @@
+#include "AssetManager.h"
+#include "Logging.h"
+
+#include <algorithm>
+#include <format>
+
+namespace BlastOff
+{
+	AssetLoadTimer::AssetLoadTimer() :
+		m_Start(high_resolution_clock::now())
+	{
+
+	}
+
+	uint64_t AssetLoadTimer::CalculateElapsed() const
+	{
+		const auto duration = high_resolution_clock::now() - m_Start;
+		return duration_cast<nanoseconds>(duration).count();
+	}
+
+
+	void AssetManager::OpenArchive(const char* const path)
+	{
+		m_Archive = std::make_unique<AssetArchive>(path);
+		if (!m_Archive->IsOpen())
+			m_Archive = nullptr;
+	}
+
+	const AssetArchive* AssetManager::GetArchive() const
+	{
+		return m_Archive.get();
+	}
+
+	void AssetManager::SetLazyLoadsExpected(const bool areExpected)
+	{
+		m_LazyLoadsExpected = areExpected;
+	}
+
+	size_t AssetManager::CalculateResidentBytes() const
+	{
+		size_t result = 0;
+		for (const AssetTable& table : m_Tables)
+		{
+			for (const AssetRecord& record : table.records)
+				result += record.byteSize;
+		}
+		return result;
+	}
+
+	size_t AssetManager::CalculateResidentCount() const
+	{
+		size_t result = 0;
+		for (const AssetTable& table : m_Tables)
+		{
+			for (const AssetRecord& record : table.records)
+			{
+				if (record.isLoaded)
+					result++;
+			}
+		}
+		return result;
+	}
+
+	vector<string> AssetManager::FormatReport() const
+	{
+		struct Entry
+		{
+			AssetType type = AssetType::Image;
+			const AssetRecord* record = nullptr;
+		};
+
+		const auto collectEntries =
+			[this]() -> vector<Entry>
+			{
+				vector<Entry> result = {};
+				for (size_t index = 0; index < m_Tables.size(); index++)
+				{
+					for (const AssetRecord& record : m_Tables[index].records)
+					{
+						if (record.isLoaded)
+							result.push_back({ (AssetType)index, &record });
+					}
+				}
+
+				std::stable_sort(
+					result.begin(), 
+					result.end(),
+					[](const Entry& first, const Entry& second)
+					{
+						return first.record->byteSize > second.record->byteSize;
+					}
+				);
+				return result;
+			};
+
+		const auto toMebibytes =
+			[](const size_t bytes) -> float
+			{
+				return bytes / (1024.0f * 1024.0f);
+			};
+
+		const auto toMilliseconds =
+			[](const uint64_t nanoseconds) -> float
+			{
+				return nanoseconds / 1'000'000.0f;
+			};
+
+		const vector<Entry> entries = collectEntries();
+
+		uint64_t totalLoadTime = 0;
+		for (const Entry& entry : entries)
+			totalLoadTime += entry.record->loadTime;
+
+		vector<string> result = {};
+		result.reserve(entries.size() + 1);
+		result.push_back(std::format(
+			"{} assets resident, {:.2f} MiB, {:.2f} ms spent loading",
+			entries.size(),
+			toMebibytes(CalculateResidentBytes()),
+			toMilliseconds(totalLoadTime)
+		));
+
+		for (const Entry& entry : entries)
+		{
+			const AssetRecord& record = *entry.record;
+			result.push_back(std::format(
+				"{} \"{}\": {:.2f} MiB, {:.2f} ms, {} references",
+				GetTypeName(entry.type),
+				record.path,
+				toMebibytes(record.byteSize),
+				toMilliseconds(record.loadTime),
+				record.referenceCount
+			));
+		}
+		return result;
+	}
+
+	size_t AssetManager::PathHasher::operator()(const string_view path) const
+	{
+		return std::hash<string_view>()(path);
+	}
+
+	uint32_t AssetManager::ResolveIndex(
+		const AssetType type, 
+		const string_view path
+	)
+	{
+		const uint32_t existing = FindIndex(type, path);
+		if (existing != ImageHandle::c_InvalidIndex)
+			return existing;
+
+		AssetTable& table = m_Tables[(size_t)type];
+		const uint32_t result = (uint32_t)table.records.size();
+
+		AssetRecord record = {};
+		record.path = string(path);
+		table.records.push_back(record);
+		table.handles.insert({ record.path, result });
+		return result;
+	}
+
+	uint32_t AssetManager::FindIndex(
+		const AssetType type, 
+		const string_view path
+	) const
+	{
+		const HandleMap& handles = m_Tables[(size_t)type].handles;
+		const auto found = handles.find(path);
+		if (found == handles.end())
+			return ImageHandle::c_InvalidIndex;
+
+		return found->second;
+	}
+
+	AssetRecord& AssetManager::GetMutableRecord(
+		const AssetType type, 
+		const uint32_t index
+	)
+	{
+		return m_Tables[(size_t)type].records.at(index);
+	}
+
+	void AssetManager::OnLazyLoad(
+		const AssetType type, 
+		const uint32_t index
+	) const
+	{
+		if (m_LazyLoadsExpected)
+			return;
+
+		const AssetRecord& record = m_Tables[(size_t)type].records.at(index);
+		const string message = std::format(
+			"Loaded {} \"{}\" lazily, after preloading finished.",
+			GetTypeName(type),
+			record.path
+		);
+		Logging::LogWarning(message.c_str());
+	}
+
+	const char* AssetManager::GetTypeName(const AssetType type)
+	{
+		switch (type)
+		{
+			case AssetType::Image:
+				return "image";
+
+			case AssetType::Sound:
+				return "sound";
+
+			case AssetType::Music:
+				return "music";
+
+			default:
+				return "unknown";
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,163 @@
+#pragma once
+
+#include "Utils.h"
+#include "Enums.h"
+#include "AssetArchive.h"
+
+namespace BlastOff
+{
+	// a path resolved once, so it can be looked up again by index.
+	// typed, so an image handle can't be handed to the sound loader
+	template <AssetType Type>
+	struct AssetHandle
+	{
+		static constexpr uint32_t c_InvalidIndex = UINT32_MAX;
+
+		uint32_t index = c_InvalidIndex;
+
+		bool IsValid() const
+		{
+			return index != c_InvalidIndex;
+		}
+	};
+
+	using ImageHandle = AssetHandle<AssetType::Image>;
+	using SoundHandle = AssetHandle<AssetType::Sound>;
+	using MusicHandle = AssetHandle<AssetType::Music>;
+
+	// starts when constructed, for AssetManager::MarkLoaded()
+	struct AssetLoadTimer
+	{
+		AssetLoadTimer();
+
+		// in nanoseconds
+		uint64_t CalculateElapsed() const;
+
+	private:
+		high_resolution_clock::time_point m_Start = {};
+	};
+
+	struct AssetRecord
+	{
+		string path = "";
+		bool isLoaded = false;
+
+		// what it takes up once loaded, as best as can be told
+		size_t byteSize = 0;
+
+		// in nanoseconds
+		uint64_t loadTime = 0;
+
+		// how many times it's been handed out.
+		// nothing is released before its loader goes
+		uint32_t referenceCount = 0;
+	};
+
+	// every asset the loaders know of, by type and handle.
+	// the loaders keep the assets themselves, indexed the same way
+	struct AssetManager
+	{
+		// the handle for this path, loaded or not.
+		// only allocates the first time a path is seen
+		template <AssetType Type>
+		AssetHandle<Type> Resolve(const string_view path)
+		{
+			return { ResolveIndex(Type, path) };
+		}
+
+		// invalid if the path has never been resolved
+		template <AssetType Type>
+		AssetHandle<Type> Find(const string_view path) const
+		{
+			return { FindIndex(Type, path) };
+		}
+
+		template <AssetType Type>
+		bool IsLoaded(const string_view path) const
+		{
+			const AssetHandle<Type> handle = Find<Type>(path);
+			return handle.IsValid() && GetRecord(handle).isLoaded;
+		}
+
+		template <AssetType Type>
+		const AssetRecord& GetRecord(const AssetHandle<Type> handle) const
+		{
+			return m_Tables[(size_t)Type].records.at(handle.index);
+		}
+
+		template <AssetType Type>
+		void AddReference(const AssetHandle<Type> handle)
+		{
+			GetMutableRecord(Type, handle.index).referenceCount++;
+		}
+
+		template <AssetType Type>
+		void MarkLoaded(
+			const AssetHandle<Type> handle,
+			const size_t byteSize,
+			const uint64_t loadTime
+		)
+		{
+			AssetRecord& record = GetMutableRecord(Type, handle.index);
+			record.isLoaded = true;
+			record.byteSize = byteSize;
+			record.loadTime = loadTime;
+		}
+
+		// the loaders look for cooked assets in here first.
+		// without one, they only ever use the loose files
+		void OpenArchive(const char* const path);
+		const AssetArchive* GetArchive() const;
+
+		// once everything's been preloaded, a lazy load is a hitch,
+		// so each one is logged
+		void SetLazyLoadsExpected(const bool areExpected);
+
+		template <AssetType Type>
+		void OnLazyLoad(const AssetHandle<Type> handle) const
+		{
+			OnLazyLoad(Type, handle.index);
+		}
+
+		size_t CalculateResidentBytes() const;
+		size_t CalculateResidentCount() const;
+
+		// a summary line, then every loaded asset, largest first
+		vector<string> FormatReport() const;
+
+	private:
+		// hashes string_views and strings alike,
+		// so looking up a const char* never builds a string
+		struct PathHasher
+		{
+			using is_transparent = void;
+
+			size_t operator()(const string_view path) const;
+		};
+
+		using HandleMap =
+			unordered_map<string, uint32_t, PathHasher, std::equal_to<>>;
+
+		struct AssetTable
+		{
+			HandleMap handles = {};
+			vector<AssetRecord> records = {};
+		};
+
+		array<AssetTable, (size_t)AssetType::Count> m_Tables = {};
+		bool m_LazyLoadsExpected = true;
+
+		unique_ptr<AssetArchive> m_Archive = nullptr;
+
+		uint32_t ResolveIndex(const AssetType type, const string_view path);
+		uint32_t FindIndex(const AssetType type, const string_view path) const;
+		AssetRecord& GetMutableRecord(
+			const AssetType type, 
+			const uint32_t index
+		);
+
+		void OnLazyLoad(const AssetType type, const uint32_t index) const;
+
+		static const char* GetTypeName(const AssetType type);
+	};
+}
\ No newline at end of file
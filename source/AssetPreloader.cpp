@@ -0,0 +1,405 @@
+#include "AssetPreloader.h"
+#include "GUI.h"
+#include "Logging.h"
+#include "Player.h"
+#include "Powerup.h"
+#include "Profiler.h"
+#include "Props.h"
+
+namespace BlastOff
+{
+	AssetManifest AssetManifest::ForState(const ProgramState state)
+	{
+		const auto append =
+			[](vector<string>* const paths, const vector<string>& values)
+			{
+				paths->insert(paths->end(), values.begin(), values.end());
+			};
+
+		// the cutscene plays behind both menus,
+		// so they need almost everything the game does
+		const auto addScene =
+			[&](AssetManifest* const manifest)
+			{
+				vector<string>* const paths = &manifest->imagePaths;
+				append(paths, Player::GetTexturePaths());
+				append(paths, {
+					SpeedUpPowerup::c_TexturePath,
+					FuelUpPowerup::c_TexturePath,
+					DownforcePowerup::c_TexturePath,
+					CloudKind::c_Low.texturePath,
+					CloudKind::c_High.texturePath
+				});
+				append(paths, Crag::GetTexturePaths());
+				append(paths, SpawnPlatform::GetTexturePaths());
+				append(paths, FloatingPlatformSegment::GetTexturePaths());
+				append(paths, FuelBar::GetTexturePaths());
+				append(paths, SpeedupBar::GetTexturePaths());
+			};
+
+		// paths shared between buttons are only queued once
+		AssetManifest result = {};
+		vector<string>* const paths = &result.imagePaths;
+		switch (state)
+		{
+			case ProgramState::Game:
+				addScene(&result);
+				append(paths, MuteButton::GetTexturePaths());
+				append(paths, ResetButton::GetTexturePaths());
+				append(paths, TopRightExitButton::GetTexturePaths());
+				append(paths, CenterMenuExitButton::GetTexturePaths());
+				append(&result.soundPaths, {
+					"win.wav",
+					"lose.wav",
+					"egg1.wav",
+					"egg2.wav"
+				});
+				break;
+
+			case ProgramState::MainMenu:
+				addScene(&result);
+				append(paths, PlayButton::GetTexturePaths());
+				append(paths, SettingsButton::GetTexturePaths());
+				append(paths, MainMenuExitButton::GetTexturePaths());
+				result.musicPaths.push_back("rifftastic.ogg");
+				break;
+
+			case ProgramState::SettingsMenu:
+				addScene(&result);
+				append(paths, MuteButton::GetTexturePaths());
+				append(paths, TopRightExitButton::GetTexturePaths());
+				append(paths, CenterMenuExitButton::GetTexturePaths());
+				append(paths, SaveButton::GetTexturePaths());
+				append(paths, YesButton::GetTexturePaths());
+				append(paths, NoButton::GetTexturePaths());
+				append(paths, SettingsMenuCancelButton::GetTexturePaths());
+				break;
+
+			default:
+				break;
+		}
+		return result;
+	}
+
+
+	AssetPreloader::AssetPreloader(
+		AssetManager* const assetManager,
+		ImageTextureLoader* const imageTextureLoader,
+		SoundLoader* const soundLoader,
+		MusicLoader* const musicLoader,
+		const size_t threadCount
+	) :
+		m_AssetManager(assetManager),
+		m_ImageTextureLoader(imageTextureLoader),
+		m_SoundLoader(soundLoader),
+		m_MusicLoader(musicLoader)
+	{
+		m_Workers.reserve(threadCount);
+		for (size_t index = 0; index < threadCount; index++)
+			m_Workers.push_back(std::thread([this]() { RunWorker(); }));
+	}
+
+	AssetPreloader::~AssetPreloader()
+	{
+		{
+			const std::lock_guard lock(m_Mutex);
+			m_ShouldStop = true;
+		}
+		m_JobCondition.notify_all();
+		for (std::thread& worker : m_Workers)
+			worker.join();
+
+		// anything decoded but never finished is still in memory
+		for (const DecodedAsset& asset : m_Decoded)
+		{
+			if (asset.image)
+				asset.image->Unload();
+			if (asset.sound)
+				asset.sound->Unload();
+		}
+		for (const DecodedImage& decoded : m_AtlasImages)
+			decoded.Unload();
+	}
+
+	void AssetPreloader::EnqueueAtlases()
+	{
+		const vector<string> paths = m_ImageTextureLoader->FindAtlasPaths();
+
+		const size_t enqueuedCount = m_EnqueuedCount;
+		SubmitAll<AssetType::Image>(paths, true);
+		m_PendingAtlasCount += m_EnqueuedCount - enqueuedCount;
+	}
+
+	void AssetPreloader::Enqueue(const AssetManifest& manifest)
+	{
+		SubmitAll<AssetType::Image>(manifest.imagePaths, false);
+		SubmitAll<AssetType::Sound>(manifest.soundPaths, false);
+
+		for (const string& path : manifest.musicPaths)
+		{
+			const MusicHandle handle = m_MusicLoader->Resolve(path);
+			if (m_AssetManager->GetRecord(handle).isLoaded)
+				continue;
+			if (!TryQueue(AssetType::Music, handle.index))
+				continue;
+
+			m_MusicHandles.push_back(handle);
+			m_EnqueuedCount++;
+		}
+	}
+
+	void AssetPreloader::Update(const float budget)
+	{
+		PROFILE_ZONE("AssetPreloader::Update");
+
+		const AssetLoadTimer timer;
+		const uint64_t budgetInNanoseconds =
+		{
+			(uint64_t)(budget * 1'000'000'000.0f)
+		};
+		const auto hasBudgetLeft =
+			[&]() -> bool
+			{
+				return timer.CalculateElapsed() < budgetInNanoseconds;
+			};
+
+		const auto popDecoded =
+			[this]() -> optional<DecodedAsset>
+			{
+				const std::lock_guard lock(m_Mutex);
+				if (m_Decoded.empty())
+					return std::nullopt;
+
+				DecodedAsset result = std::move(m_Decoded.front());
+				m_Decoded.pop_front();
+				return result;
+			};
+
+		// without workers, nothing else would ever decode it
+		const auto decodeNext =
+			[this]() -> optional<DecodedAsset>
+			{
+				if (!m_Workers.empty())
+					return std::nullopt;
+
+				const optional<Job> job = PopJob();
+				if (!job)
+					return std::nullopt;
+
+				return Decode(*job);
+			};
+
+		const auto openMusic =
+			[this]()
+			{
+				m_MusicLoader->Preload(m_MusicHandles.front());
+				m_MusicHandles.pop_front();
+				m_FinishedCount++;
+			};
+
+		while (hasBudgetLeft())
+		{
+			optional<DecodedAsset> decoded = popDecoded();
+			if (!decoded)
+				decoded = decodeNext();
+
+			if (decoded)
+				Finish(*decoded);
+			else if (!m_MusicHandles.empty())
+				openMusic();
+			else
+				break;
+		}
+	}
+
+	bool AssetPreloader::IsResident(const AssetManifest& manifest) const
+	{
+		return
+			AreResident<AssetType::Image>(manifest.imagePaths) &&
+			AreResident<AssetType::Sound>(manifest.soundPaths) &&
+			AreResident<AssetType::Music>(manifest.musicPaths);
+	}
+
+	float AssetPreloader::CalculateProgress() const
+	{
+		if (!m_EnqueuedCount)
+			return 1;
+
+		return m_FinishedCount / (float)m_EnqueuedCount;
+	}
+
+	bool AssetPreloader::TryQueue(const AssetType type, const uint32_t index)
+	{
+		vector<bool>& isQueued = m_IsQueued[(size_t)type];
+		if (index >= isQueued.size())
+			isQueued.resize(index + 1, false);
+
+		if (isQueued[index])
+			return false;
+
+		isQueued[index] = true;
+		return true;
+	}
+
+	void AssetPreloader::Submit(const Job& job)
+	{
+		{
+			const std::lock_guard lock(m_Mutex);
+			m_Jobs.push_back(job);
+		}
+		m_JobCondition.notify_one();
+		m_EnqueuedCount++;
+	}
+
+	void AssetPreloader::RunWorker()
+	{
+		std::unique_lock lock(m_Mutex);
+		while (true)
+		{
+			const auto hasWork =
+				[this]() { return m_ShouldStop || !m_Jobs.empty(); };
+			m_JobCondition.wait(lock, hasWork);
+			if (m_ShouldStop)
+				return;
+
+			const Job job = m_Jobs.front();
+			m_Jobs.pop_front();
+
+			lock.unlock();
+			DecodedAsset decoded = Decode(job);
+			lock.lock();
+
+			m_Decoded.push_back(std::move(decoded));
+		}
+	}
+
+	optional<AssetPreloader::Job> AssetPreloader::PopJob()
+	{
+		const std::lock_guard lock(m_Mutex);
+		if (m_Jobs.empty())
+			return std::nullopt;
+
+		const Job result = m_Jobs.front();
+		m_Jobs.pop_front();
+		return result;
+	}
+
+	AssetPreloader::DecodedAsset AssetPreloader::Decode
+		(const Job& job) const
+	{
+		PROFILE_ZONE("AssetPreloader::Decode");
+
+		DecodedAsset result = {};
+		result.job = job;
+		switch (job.type)
+		{
+			case AssetType::Image:
+				result.image = m_ImageTextureLoader->DecodePNG(job.path);
+				break;
+
+			case AssetType::Sound:
+				result.sound = m_SoundLoader->DecodeWAV(job.path);
+				break;
+
+			default:
+				break;
+		}
+		return result;
+	}
+
+	void AssetPreloader::Finish(DecodedAsset& asset)
+	{
+		const auto markFailed =
+			[&, this]()
+			{
+				const Job& job = asset.job;
+				vector<bool>& hasFailed = m_HasFailed[(size_t)job.type];
+				if (job.index >= hasFailed.size())
+					hasFailed.resize(job.index + 1, false);
+				hasFailed[job.index] = true;
+
+				const string message =
+				{
+					"AssetPreloader::Finish() failed: "
+					"Unable to decode \"" + job.path + "\"."
+				};
+				Logging::LogWarning(message.c_str());
+			};
+
+		const auto finishAtlased =
+			[&, this]()
+			{
+				if (asset.image)
+					m_AtlasImages.push_back(*asset.image);
+
+				m_PendingAtlasCount--;
+				if (m_PendingAtlasCount)
+					return;
+
+				// the one step that can't be split up,
+				// so it's allowed to run over the budget
+				m_ImageTextureLoader->BuildAtlases(m_AtlasImages);
+				m_AtlasImages.clear();
+			};
+
+		if (!asset.image && !asset.sound)
+			markFailed();
+
+		if (asset.job.isAtlased)
+			finishAtlased();
+		else if (asset.image)
+			m_ImageTextureLoader->InsertDecodedImage(*asset.image);
+		else if (asset.sound)
+			m_SoundLoader->InsertDecodedSound(*asset.sound);
+
+		m_FinishedCount++;
+	}
+
+	template <AssetType Type>
+	void AssetPreloader::SubmitAll(
+		const vector<string>& paths,
+		const bool isAtlased
+	)
+	{
+		for (const string& path : paths)
+		{
+			const AssetHandle<Type> handle = 
+			{
+				m_AssetManager->Resolve<Type>(path)
+			};
+			if (m_AssetManager->GetRecord(handle).isLoaded)
+				continue;
+			if (!TryQueue(Type, handle.index))
+				continue;
+
+			Job job = {};
+			job.type = Type;
+			job.index = handle.index;
+			job.path = path;
+			job.isAtlased = isAtlased;
+			Submit(job);
+		}
+	}
+
+	template <AssetType Type>
+	bool AssetPreloader::AreResident(const vector<string>& paths) const
+	{
+		const vector<bool>& hasFailed = m_HasFailed[(size_t)Type];
+		for (const string& path : paths)
+		{
+			if (m_AssetManager->IsLoaded<Type>(path))
+				continue;
+
+			const AssetHandle<Type> handle = m_AssetManager->Find<Type>(path);
+			const bool failed =
+			{
+				handle.IsValid() && 
+				(handle.index < hasFailed.size()) && 
+				hasFailed[handle.index]
+			};
+			if (!failed)
+				return false;
+		}
+		return true;
+	}
+}
\ No newline at end of file
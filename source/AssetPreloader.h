@@ -0,0 +1,120 @@
+#pragma once
+
+#include "Utils.h"
+#include "Enums.h"
+#include "AssetManager.h"
+#include "Graphics.h"
+#include "Sound.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace BlastOff
+{
+	// everything a state needs resident before it's entered,
+	// so nothing is loaded lazily once it's running
+	struct AssetManifest
+	{
+		vector<string> imagePaths = {};
+		vector<string> soundPaths = {};
+		vector<string> musicPaths = {};
+
+		static AssetManifest ForState(const ProgramState state);
+	};
+
+	// decodes PNGs and WAVs on worker threads, then hands them
+	// to their loaders on the main thread, a few per frame.
+	// the loaders and the asset manager are only ever touched
+	// from the main thread. with no threads at all, 
+	// Update() does the decoding too, within the same budget
+	struct AssetPreloader
+	{
+		AssetPreloader(
+			AssetManager* const assetManager,
+			ImageTextureLoader* const imageTextureLoader,
+			SoundLoader* const soundLoader,
+			MusicLoader* const musicLoader,
+			const size_t threadCount
+		);
+		~AssetPreloader();
+
+		// decodes every image the atlases will hold.
+		// they're packed and uploaded once the last one is decoded
+		void EnqueueAtlases();
+		void Enqueue(const AssetManifest& manifest);
+
+		// finishes whatever has been decoded, 
+		// until the budget, in seconds, runs out
+		void Update(const float budget);
+
+		// counts anything that failed to load, 
+		// since waiting on it would never end
+		bool IsResident(const AssetManifest& manifest) const;
+
+		// from 0 to 1, over everything ever enqueued
+		float CalculateProgress() const;
+
+	private:
+		struct Job
+		{
+			AssetType type = AssetType::Image;
+			uint32_t index = ImageHandle::c_InvalidIndex;
+			string path = "";
+			bool isAtlased = false;
+		};
+
+		struct DecodedAsset
+		{
+			Job job = {};
+			optional<DecodedImage> image = std::nullopt;
+			optional<DecodedSound> sound = std::nullopt;
+		};
+
+		AssetManager* m_AssetManager = nullptr;
+		ImageTextureLoader* m_ImageTextureLoader = nullptr;
+		SoundLoader* m_SoundLoader = nullptr;
+		MusicLoader* m_MusicLoader = nullptr;
+
+		// main thread only. indexed by handle
+		array<vector<bool>, (size_t)AssetType::Count> m_IsQueued = {};
+		array<vector<bool>, (size_t)AssetType::Count> m_HasFailed = {};
+
+		// music streams decode as they play, 
+		// so opening them never leaves the main thread
+		std::deque<MusicHandle> m_MusicHandles = {};
+
+		// held back until every one of them is decoded,
+		// since the packer needs them all at once
+		vector<DecodedImage> m_AtlasImages = {};
+		size_t m_PendingAtlasCount = 0;
+
+		size_t m_EnqueuedCount = 0;
+		size_t m_FinishedCount = 0;
+
+		// guards everything below
+		std::mutex m_Mutex;
+		std::condition_variable m_JobCondition;
+		std::deque<Job> m_Jobs = {};
+		std::deque<DecodedAsset> m_Decoded = {};
+		bool m_ShouldStop = false;
+
+		vector<std::thread> m_Workers = {};
+
+		// false if it's already been queued once
+		bool TryQueue(const AssetType type, const uint32_t index);
+		void Submit(const Job& job);
+
+		template <AssetType Type>
+		void SubmitAll(const vector<string>& paths, const bool isAtlased);
+
+		void RunWorker();
+		optional<Job> PopJob();
+		DecodedAsset Decode(const Job& job) const;
+		void Finish(DecodedAsset& asset);
+
+		template <AssetType Type>
+		bool AreResident(const vector<string>& paths) const;
+	};
+}
\ No newline at end of file
@@ -1,8 +1,21 @@
 #include "Program.h"
+#include "Simulation.h"
 
-int main()
+int main(int argc, char** argv)
 {
-    BlastOff::Program program;
+    const BlastOff::ProgramArguments arguments = 
+    {
+        BlastOff::ProgramArguments::Parse(argc, argv)
+    };
+    if (arguments.gameCount)
+    {
+        BlastOff::MonteCarloRunner runner(arguments);
+        runner.Run();
+        runner.PrintReport();
+        return 0;
+    }
+
+    BlastOff::Program program(arguments);
     while (program.IsRunning())
         program.RunLoopIteration();
 
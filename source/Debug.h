@@ -4,4 +4,10 @@
 #define COMPILE_CONFIG_DEBUG _DEBUG
 #else
 #define COMPILE_CONFIG_DEBUG 0
+#endif
+
+// profiling zones are cheap, but not free.
+// define this as 0 to compile every one of them out
+#ifndef COMPILE_CONFIG_PROFILING
+#define COMPILE_CONFIG_PROFILING 1
 #endif
\ No newline at end of file
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+
 namespace BlastOff
 {
 	enum class GameOutcome
@@ -14,6 +16,44 @@ namespace BlastOff
 		None,
 		Game,
 		MainMenu,
-		SettingsMenu
+		SettingsMenu,
+
+		// waiting on the preloader, before entering another state
+		Loading
+	};
+
+	enum class AssetType
+	{
+		Image,
+		Sound,
+		Music,
+		Count
+	};
+
+	// written into archives, so never reorder these
+	enum class ArchiveEntryType : uint32_t
+	{
+		// stored as is, such as music and fonts
+		File,
+
+		// decoded to 8-bit RGBA
+		RawImage,
+
+		// decoded to PCM samples
+		RawWave
+	};
+
+	// back to front
+	enum class RenderLayer
+	{
+		Background,
+		Terrain,
+		CloudsBelowPlayer,
+		Powerups,
+		Platforms,
+		Player,
+		CloudsAbovePlayer,
+		Interface,
+		Menus
 	};
 }
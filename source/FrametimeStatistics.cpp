@@ -0,0 +1,262 @@
+#include "FrametimeStatistics.h"
+
+#include <algorithm>
+#include <format>
+
+namespace BlastOff
+{
+	namespace
+	{
+		float ToMilliseconds(const uint64_t nanoseconds)
+		{
+			return nanoseconds / 1'000'000.0f;
+		}
+	}
+
+	void FrametimeHistogram::Add(const uint64_t sample)
+	{
+		// anything too slow for the last bucket still lands in it,
+		// and m_Max keeps the real value
+		const size_t index = std::min(
+			(size_t)(sample / c_BucketWidth),
+			c_BucketCount - 1
+		);
+		m_Buckets[index]++;
+
+		m_Count++;
+		m_Max = std::max(m_Max, sample);
+	}
+
+	FrametimePercentiles FrametimeHistogram::CalculatePercentiles() const
+	{
+		FrametimePercentiles result = {};
+		result.p50 = CalculatePercentile(0.5f);
+		result.p95 = CalculatePercentile(0.95f);
+		result.p99 = CalculatePercentile(0.99f);
+		result.max = ToMilliseconds(m_Max);
+		return result;
+	}
+
+	float FrametimeHistogram::CalculatePercentile
+		(const float percentile) const
+	{
+		if (!m_Count)
+			return 0;
+
+		const uint64_t rank =
+		{
+			std::max((uint64_t)ceilf(percentile * m_Count), (uint64_t)1)
+		};
+
+		uint64_t seen = 0;
+		for (size_t index = 0; index < c_BucketCount; index++)
+		{
+			seen += m_Buckets[index];
+			if (seen < rank)
+				continue;
+
+			const uint64_t bucketEnd = (index + 1) * c_BucketWidth;
+			return ToMilliseconds(std::min(bucketEnd, m_Max));
+		}
+		return ToMilliseconds(m_Max);
+	}
+
+
+	FrametimeStatistics::FrametimeStatistics(const float targetFrametime) :
+		m_TargetFrametime((uint64_t)(targetFrametime * 1'000'000'000.0f))
+	{
+	}
+
+	void FrametimeStatistics::AddFrame(const FrameSample& sample)
+	{
+		m_Window[m_FrameCount % c_WindowLength] = sample;
+
+		m_FrameHistogram.Add(sample.frame);
+		m_UpdateHistogram.Add(sample.update);
+		m_DrawHistogram.Add(sample.draw);
+
+		if (IsOverBudget(sample))
+			m_OverBudgetCount++;
+		if (IsHitch(sample))
+			m_HitchCount++;
+
+		if (sample.frame > m_LongestFrame.frame)
+		{
+			m_LongestFrame = sample;
+			m_LongestFrameIndex = m_FrameCount;
+		}
+		m_FrameCount++;
+	}
+
+	FrametimeReport FrametimeStatistics::CalculateRecentReport() const
+	{
+		const size_t sampleCount =
+		{
+			(size_t)std::min(m_FrameCount, (uint64_t)c_WindowLength)
+		};
+
+		// oldest first, so the frame index of the longest hitch
+		// can be worked out from its position
+		const uint64_t firstFrame = m_FrameCount - sampleCount;
+		const auto getSample =
+			[&, this](const size_t index) -> const FrameSample&
+			{
+				return m_Window[(firstFrame + index) % c_WindowLength];
+			};
+
+		const auto calculatePercentiles =
+			[&](const auto& getField) -> FrametimePercentiles
+			{
+				array<uint64_t, c_WindowLength> sorted = { 0 };
+				for (size_t index = 0; index < sampleCount; index++)
+					sorted[index] = getField(getSample(index));
+
+				const auto end = sorted.begin() + sampleCount;
+				std::sort(sorted.begin(), end);
+
+				const auto calculatePercentile =
+					[&](const float percentile) -> float
+					{
+						const float rank = ceilf(percentile * sampleCount);
+						const size_t index =
+						{
+							std::max((size_t)rank, (size_t)1) - 1
+						};
+						return ToMilliseconds(sorted[index]);
+					};
+
+				FrametimePercentiles result = {};
+				if (!sampleCount)
+					return result;
+
+				result.p50 = calculatePercentile(0.5f);
+				result.p95 = calculatePercentile(0.95f);
+				result.p99 = calculatePercentile(0.99f);
+				result.max = ToMilliseconds(sorted[sampleCount - 1]);
+				return result;
+			};
+
+		FrametimeReport result = {};
+		result.frameCount = sampleCount;
+		result.frame = calculatePercentiles(
+			[](const FrameSample& sample) { return sample.frame; }
+		);
+		result.update = calculatePercentiles(
+			[](const FrameSample& sample) { return sample.update; }
+		);
+		result.draw = calculatePercentiles(
+			[](const FrameSample& sample) { return sample.draw; }
+		);
+
+		uint64_t longestFrame = 0;
+		for (size_t index = 0; index < sampleCount; index++)
+		{
+			const FrameSample& sample = getSample(index);
+			if (IsOverBudget(sample))
+				result.overBudgetCount++;
+			if (IsHitch(sample))
+				result.hitchCount++;
+
+			if (sample.frame > longestFrame)
+			{
+				longestFrame = sample.frame;
+				result.longestHitch = ToMilliseconds(sample.frame);
+				result.longestHitchFrame = firstFrame + index;
+				result.longestHitchState = sample.state;
+			}
+		}
+		return result;
+	}
+
+	FrametimeReport FrametimeStatistics::CalculateSessionReport() const
+	{
+		FrametimeReport result = {};
+		result.frameCount = m_FrameCount;
+		result.frame = m_FrameHistogram.CalculatePercentiles();
+		result.update = m_UpdateHistogram.CalculatePercentiles();
+		result.draw = m_DrawHistogram.CalculatePercentiles();
+
+		result.overBudgetCount = m_OverBudgetCount;
+		result.hitchCount = m_HitchCount;
+		result.longestHitch = ToMilliseconds(m_LongestFrame.frame);
+		result.longestHitchFrame = m_LongestFrameIndex;
+		result.longestHitchState = m_LongestFrame.state;
+		return result;
+	}
+
+	const char* FrametimeStatistics::GetStateName(const ProgramState state)
+	{
+		switch (state)
+		{
+			case ProgramState::Game:
+				return "Game";
+
+			case ProgramState::MainMenu:
+				return "MainMenu";
+
+			case ProgramState::SettingsMenu:
+				return "SettingsMenu";
+
+			case ProgramState::Loading:
+				return "Loading";
+
+			default:
+				return "None";
+		}
+	}
+
+	vector<string> FrametimeStatistics::FormatReport
+		(const FrametimeReport& report)
+	{
+		const auto formatPercentiles =
+			[](const char* const name, const FrametimePercentiles& value)
+			{
+				return std::format(
+					"{}: {:.2f} p50, {:.2f} p95, {:.2f} p99, {:.2f} max (ms)",
+					name,
+					value.p50,
+					value.p95,
+					value.p99,
+					value.max
+				);
+			};
+
+		const string budget = std::format(
+			"{} of {} frames over budget, {} hitches",
+			report.overBudgetCount,
+			report.frameCount,
+			report.hitchCount
+		);
+		const string longestHitch = std::format(
+			"longest frame: {:.2f} ms, frame {} in {}",
+			report.longestHitch,
+			report.longestHitchFrame,
+			GetStateName(report.longestHitchState)
+		);
+
+		return
+		{
+			formatPercentiles("frame", report.frame),
+			formatPercentiles("update", report.update),
+			formatPercentiles("draw", report.draw),
+			budget,
+			longestHitch
+		};
+	}
+
+	bool FrametimeStatistics::IsOverBudget(const FrameSample& sample) const
+	{
+		// the rest of the frame is spent waiting,
+		// which doesn't count against the budget
+		return (sample.update + sample.draw) > m_TargetFrametime;
+	}
+
+	bool FrametimeStatistics::IsHitch(const FrameSample& sample) const
+	{
+		return sample.frame > (m_TargetFrametime * 2);
+	}
+
+	// 50 microseconds, so the last bucket ends just past 51 ms,
+	// a little over three frames at 60 Hz
+	const uint64_t FrametimeHistogram::c_BucketWidth = 50'000;
+}
\ No newline at end of file
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "Utils.h"
+#include "Enums.h"
+
+namespace BlastOff
+{
+	// in nanoseconds
+	struct FrameSample
+	{
+		uint64_t frame = 0;
+		uint64_t update = 0;
+		uint64_t draw = 0;
+
+		// what the program was doing when the frame began
+		ProgramState state = ProgramState::None;
+	};
+
+	// in milliseconds
+	struct FrametimePercentiles
+	{
+		float p50 = 0;
+		float p95 = 0;
+		float p99 = 0;
+		float max = 0;
+	};
+
+	struct FrametimeReport
+	{
+		uint64_t frameCount = 0;
+
+		FrametimePercentiles frame = {};
+		FrametimePercentiles update = {};
+		FrametimePercentiles draw = {};
+
+		// frames whose update and draw, together,
+		// took longer than the target frametime
+		uint64_t overBudgetCount = 0;
+
+		// frames that took over twice the target frametime, end to end
+		uint64_t hitchCount = 0;
+
+		// the slowest frame, in milliseconds, and when it happened
+		float longestHitch = 0;
+		uint64_t longestHitchFrame = 0;
+		ProgramState longestHitchState = ProgramState::None;
+	};
+
+	// fixed-width buckets, so adding a sample is one increment.
+	// percentiles come out rounded up to the end of their bucket
+	struct FrametimeHistogram
+	{
+		void Add(const uint64_t sample);
+
+		// in milliseconds
+		FrametimePercentiles CalculatePercentiles() const;
+
+	private:
+		static const uint64_t c_BucketWidth;
+		static constexpr size_t c_BucketCount = 1024;
+
+		array<uint32_t, c_BucketCount> m_Buckets = { 0 };
+		uint64_t m_Count = 0;
+		uint64_t m_Max = 0;
+
+		float CalculatePercentile(const float percentile) const;
+	};
+
+	// keeps every frame of the last few seconds, for the overlay,
+	// and a histogram of every frame since the program started,
+	// for the report at exit. nothing allocates after construction
+	struct FrametimeStatistics
+	{
+		FrametimeStatistics(const float targetFrametime);
+
+		void AddFrame(const FrameSample& sample);
+
+		// exact, over the last c_WindowLength frames
+		FrametimeReport CalculateRecentReport() const;
+
+		// over every frame added, to the resolution of the histograms
+		FrametimeReport CalculateSessionReport() const;
+
+		static const char* GetStateName(const ProgramState state);
+		static vector<string> FormatReport(const FrametimeReport& report);
+
+	private:
+		static constexpr size_t c_WindowLength = 240;
+
+		uint64_t m_TargetFrametime = 0;
+
+		array<FrameSample, c_WindowLength> m_Window = {};
+		uint64_t m_FrameCount = 0;
+
+		FrametimeHistogram m_FrameHistogram = {};
+		FrametimeHistogram m_UpdateHistogram = {};
+		FrametimeHistogram m_DrawHistogram = {};
+
+		uint64_t m_OverBudgetCount = 0;
+		uint64_t m_HitchCount = 0;
+		FrameSample m_LongestFrame = {};
+		uint64_t m_LongestFrameIndex = 0;
+
+		bool IsOverBudget(const FrameSample& sample) const;
+		bool IsHitch(const FrameSample& sample) const;
+	};
+}
\ No newline at end of file
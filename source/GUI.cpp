@@ -4,6 +4,7 @@
 #include "Logging.h"
 #include "OperatingSystem.h"
 #include "Player.h"
+#include "Profiler.h"
 #include "ProgramConstants.h"
 #include "Utils.h"
 
@@ -80,10 +81,15 @@ namespace BlastOff
 		updateEnergyCrop();
 	}
 
-	void GUIBar::Draw() const
+	void GUIBar::Reset()
 	{
-		m_BackingSprite->Draw();
-		m_EnergySprite->Draw();
+		m_IsFirstUpdateCall = true;
+	}
+
+	void GUIBar::Draw(RenderQueue* const renderQueue) const
+	{
+		m_BackingSprite->Draw(renderQueue);
+		m_EnergySprite->Draw(renderQueue);
 	}
 
 	GUIBar::GUIBar(
@@ -101,7 +107,7 @@ namespace BlastOff
 		const auto initializeBackingSprite =
 			[&, this]()
 			{
-				const Texture* backingTexture = 
+				const TextureRegion* backingTexture = 
 				{
 					imageTextureLoader->LazyLoadTexture(c_BackingTexturePath)
 				};
@@ -116,7 +122,7 @@ namespace BlastOff
 		const auto initializeEnergySprite =
 			[&, this]()
 			{
-				const Texture* texture =
+				const TextureRegion* texture =
 				{
 					imageTextureLoader->LazyLoadTexture(energyTexturePath)
 				};
@@ -198,6 +204,15 @@ namespace BlastOff
 
 	}
 
+	vector<string> FuelBar::GetTexturePaths()
+	{
+		return
+		{
+			c_BackingTexturePath,
+			c_EnergyTexturePath
+		};
+	}
+
 	const char* const FuelBar::c_EnergyTexturePath =
 	{
 		"ui/fuelBarEnergy.png"
@@ -236,6 +251,15 @@ namespace BlastOff
 		moveUp();
 	}
 
+	vector<string> SpeedupBar::GetTexturePaths()
+	{
+		return
+		{
+			c_BackingTexturePath,
+			c_EnergyTexturePath
+		};
+	}
+
 	const char* const SpeedupBar::c_EnergyTexturePath =
 	{
 		"ui/speedBarEnergy.png"
@@ -252,9 +276,9 @@ namespace BlastOff
 		m_Sprite->Update();
 	}
 
-	void GUILabel::Draw() const
+	void GUILabel::Draw(RenderQueue* const renderQueue) const
 	{
-		m_Sprite->Draw();
+		m_Sprite->Draw(renderQueue);
 	}
 
 	GUILabel::GUILabel(
@@ -429,10 +453,10 @@ namespace BlastOff
 		m_EnergyLabel->Update();
 	}
 
-	void BarLabel::Draw() const
+	void BarLabel::Draw(RenderQueue* const renderQueue) const
 	{
-		m_BackingLabel->Draw();
-		m_EnergyLabel->Draw();
+		m_BackingLabel->Draw(renderQueue);
+		m_EnergyLabel->Draw(renderQueue);
 	}
 
 
@@ -514,6 +538,14 @@ namespace BlastOff
 		m_IsEnabled = false;
 	}
 
+	void Button::Reset()
+	{
+		m_IsSelected = false;
+		m_ShouldShowClickedSprite = false;
+		m_HasJustEnabled = true;
+		UseUnselectedTexture();
+	}
+
 	void Button::UpdateOpacity()
 	{
 		if (m_ParentOpacity)
@@ -582,9 +614,9 @@ namespace BlastOff
 		m_HasJustEnabled = false;
 	}
 
-	void Button::Draw() const
+	void Button::Draw(RenderQueue* const renderQueue) const
 	{
-		m_Sprite->Draw();
+		m_Sprite->Draw(renderQueue);
 	}
 
 	Button::Button(
@@ -679,6 +711,16 @@ namespace BlastOff
 		initializePosition();
 	}
 
+	vector<string> YesButton::GetTexturePaths()
+	{
+		return
+		{
+			c_UnselectedTexturePath,
+			c_SelectedTexturePath,
+			c_ClickedTexturePath
+		};
+	}
+
 	const int YesButton::c_ButtonIndex = 0;
 
 	const char* const YesButton::c_UnselectedTexturePath = 
@@ -733,6 +775,16 @@ namespace BlastOff
 		initializePosition();
 	}
 
+	vector<string> SettingsMenuCancelButton::GetTexturePaths()
+	{
+		return
+		{
+			c_UnselectedTexturePath,
+			c_SelectedTexturePath,
+			c_ClickedTexturePath
+		};
+	}
+
 	const int SettingsMenuCancelButton::c_ButtonIndex = 1;
 
 	const char* const SettingsMenuCancelButton::c_UnselectedTexturePath = 
@@ -787,6 +839,16 @@ namespace BlastOff
 		initializePosition();
 	}
 
+	vector<string> NoButton::GetTexturePaths()
+	{
+		return
+		{
+			c_UnselectedTexturePath,
+			c_SelectedTexturePath,
+			c_ClickedTexturePath
+		};
+	}
+
 	const int NoButton::c_ButtonIndex = 2;
 
 	const char* const NoButton::c_UnselectedTexturePath = 
@@ -940,12 +1002,12 @@ namespace BlastOff
 		m_InnerBackingStroke->Update();
 	}
 
-	void ThemedBacking::Draw() const
+	void ThemedBacking::Draw(RenderQueue* const renderQueue) const
 	{
-		m_OuterBackingFill->Draw();
-		m_OuterBackingStroke->Draw();
-		m_InnerBackingFill->Draw();
-		m_InnerBackingStroke->Draw();
+		m_OuterBackingFill->Draw(renderQueue);
+		m_OuterBackingStroke->Draw(renderQueue);
+		m_InnerBackingFill->Draw(renderQueue);
+		m_InnerBackingStroke->Draw(renderQueue);
 	}
 
 	
@@ -975,6 +1037,14 @@ namespace BlastOff
 		return m_HasJustFinished;
 	}
 
+	void SlideState::Reset()
+	{
+		m_HasJustFinished = false;
+		m_SlideTick = c_DeactivatedTick;
+		m_WaitTick = c_DeactivatedTick;
+		m_Sprite->SetLocalPosition(m_StartingPosition);
+	}
+
 	void SlideState::Slide(const float waitInSeconds)
 	{
 		if (waitInSeconds <= 0)
@@ -1116,12 +1186,12 @@ namespace BlastOff
 		m_SlideState->Update();
 	}
 
-	void BackgroundTint::Draw() const
+	void BackgroundTint::Draw(RenderQueue* const renderQueue) const
 	{
 		if (!m_IsEnabled)
 			return;
 
-		m_Sprite->Draw();
+		m_Sprite->Draw(renderQueue);
 	}
 
 	const float BackgroundTint::c_SlideInWait = 0;
@@ -1155,17 +1225,17 @@ namespace BlastOff
 		m_NoButton->Update();
 	}
 
-	void ConfirmationDialogue::Draw() const
+	void ConfirmationDialogue::Draw(RenderQueue* const renderQueue) const
 	{
 		if (!m_IsEnabled)
 			return;
 		
-		m_BackgroundTint->Draw();
-		m_Backing->Draw();
-		m_Message->Draw();
-		m_YesButton->Draw();
-		m_CancelButton->Draw();
-		m_NoButton->Draw();
+		m_BackgroundTint->Draw(renderQueue);
+		m_Backing->Draw(renderQueue);
+		m_Message->Draw(renderQueue);
+		m_YesButton->Draw(renderQueue);
+		m_CancelButton->Draw(renderQueue);
+		m_NoButton->Draw(renderQueue);
 	}
 
 	const float ConfirmationDialogue::c_FontSize = 32;
@@ -1376,14 +1446,25 @@ namespace BlastOff
         Button::Update();
     }
 
-    void MuteButton::Draw() const
+    void MuteButton::Draw(RenderQueue* const renderQueue) const
     {
-        Button::Draw();
+        Button::Draw(renderQueue);
 
         if (*m_IsActive)
-            m_ActiveBar->Draw();
+            m_ActiveBar->Draw(renderQueue);
     }
 
+	vector<string> MuteButton::GetTexturePaths()
+	{
+		return
+		{
+			c_UnselectedTexturePath,
+			c_SelectedTexturePath,
+			c_ClickedTexturePath,
+			c_ActiveBarTexturePath
+		};
+	}
+
 	const int MuteButton::c_ButtonIndex = 0;
 
     const Vector2f MuteButton::c_ActiveBarSize = { 21 / 40.0f, 21 / 40.0f };
@@ -1437,6 +1518,16 @@ namespace BlastOff
 		m_Sprite->SetParent(parent);
 	}
 
+	vector<string> ResetButton::GetTexturePaths()
+	{
+		return
+		{
+			c_UnselectedTexturePath,
+			c_SelectedTexturePath,
+			c_ClickedTexturePath
+		};
+	}
+
 	const char* const ResetButton::c_UnselectedTexturePath =
 	{
 		"ui/button/unselected/reset.png"
@@ -1518,6 +1609,13 @@ namespace BlastOff
 		m_SlideState->Slide(c_SlideOutWait);
 	}
 
+	void TopRightResetButton::Reset()
+	{
+		ResetButton::Reset();
+
+		m_SlideState->Reset();
+	}
+
 	void TopRightResetButton::Update()
 	{
 		ResetButton::Update();
@@ -1631,6 +1729,13 @@ namespace BlastOff
 		m_SlideState->Slide(c_SlideOutWait);
 	}
 
+	void TopRightExitButton::Reset()
+	{
+		ExitButton::Reset();
+
+		m_SlideState->Reset();
+	}
+
 	void TopRightExitButton::Update()
 	{
 		ExitButton::Update();
@@ -1638,6 +1743,16 @@ namespace BlastOff
 		m_SlideState->Update();
 	}
 
+	vector<string> TopRightExitButton::GetTexturePaths()
+	{
+		return
+		{
+			c_UnselectedTexturePath,
+			c_SelectedTexturePath,
+			c_ClickedTexturePath
+		};
+	}
+
 	const int TopRightExitButton::c_ButtonIndexInGame = 2;
 	const int TopRightExitButton::c_ButtonIndexInSettingsMenu = 1;
 	const float TopRightExitButton::c_SlideOutWait = 0;
@@ -1686,6 +1801,16 @@ namespace BlastOff
 		Translate(translation.InvertX());
 	}
 
+	vector<string> PlayButton::GetTexturePaths()
+	{
+		return
+		{
+			c_UnselectedTexturePath,
+			c_SelectedTexturePath,
+			c_ClickedTexturePath
+		};
+	}
+
 	const char* const PlayButton::c_UnselectedTexturePath = 
 	{
 		"ui/button/unselected/play.png"
@@ -1729,6 +1854,16 @@ namespace BlastOff
 		Translate(translation);
 	}
 
+	vector<string> SettingsButton::GetTexturePaths()
+	{
+		return
+		{
+			c_UnselectedTexturePath,
+			c_SelectedTexturePath,
+			c_ClickedTexturePath
+		};
+	}
+
 	const char* const SettingsButton::c_UnselectedTexturePath = 
 	{
 		"ui/button/unselected/settings.png"
@@ -1773,6 +1908,16 @@ namespace BlastOff
 		Translate(enginePosition);
 	}
 
+	vector<string> MainMenuExitButton::GetTexturePaths()
+	{
+		return
+		{
+			c_UnselectedTexturePath,
+			c_SelectedTexturePath,
+			c_ClickedTexturePath
+		};
+	}
+
 	const char* const MainMenuExitButton::c_UnselectedTexturePath = 
 	{
 		"ui/button/unselected/largeExit.png"
@@ -1940,8 +2085,18 @@ namespace BlastOff
 		m_SlideState->Slide(c_SlideInWait);
 	}
 
+	void GameEndMenu::Reset()
+	{
+		m_IsEnabled = false;
+		m_SlideState->Reset();
+		m_ResetButton->Reset();
+		m_ExitButton->Reset();
+	}
+
 	void GameEndMenu::Update()
 	{
+		PROFILE_ZONE("GameEndMenu::Update");
+
 		if (m_IsEnabled)
 		{
 			m_Message->Update();
@@ -1951,15 +2106,17 @@ namespace BlastOff
 		}
 	}
 
-	void GameEndMenu::Draw() const
+	void GameEndMenu::Draw(RenderQueue* const renderQueue) const
 	{
+		PROFILE_ZONE("GameEndMenu::Draw");
+
 		if (m_IsEnabled)
 		{
-			m_BackingFill->Draw();
-			m_BackingStroke->Draw();
-			m_Message->Draw();
-			m_ResetButton->Draw();
-			m_ExitButton->Draw();
+			m_BackingFill->Draw(renderQueue);
+			m_BackingStroke->Draw(renderQueue);
+			m_Message->Draw(renderQueue);
+			m_ResetButton->Draw(renderQueue);
+			m_ExitButton->Draw(renderQueue);
 		}
 	}
 
@@ -2092,16 +2249,20 @@ namespace BlastOff
     
     void MainMenu::Update()
     {
+        PROFILE_ZONE("MainMenu::Update");
+
         m_SettingsButton->Update();
         m_PlayButton->Update();
         m_ExitButton->Update();
     }
 
-    void MainMenu::Draw() const
+    void MainMenu::Draw(RenderQueue* const renderQueue) const
     {
-        m_SettingsButton->Draw();
-        m_PlayButton->Draw();
-        m_ExitButton->Draw();
+        PROFILE_ZONE("MainMenu::Draw");
+
+        m_SettingsButton->Draw(renderQueue);
+        m_PlayButton->Draw(renderQueue);
+        m_ExitButton->Draw(renderQueue);
     }
 
 
@@ -2371,13 +2532,13 @@ namespace BlastOff
 		m_BackingStroke->Update();
 	}
 
-	void SlideBar::Draw() const
+	void SlideBar::Draw(RenderQueue* const renderQueue) const
 	{
-		m_BackingFill->Draw();
-		m_BackingStroke->Draw();
+		m_BackingFill->Draw(renderQueue);
+		m_BackingStroke->Draw(renderQueue);
 
-		m_HandleFill->Draw();
-		m_HandleStroke->Draw();
+		m_HandleFill->Draw(renderQueue);
+		m_HandleStroke->Draw(renderQueue);
 	}
 
 	void SlideBar::InitializeHandlePosition()
@@ -2583,9 +2744,9 @@ namespace BlastOff
 		m_Sprite->Update();
 	}
 
-	void AdjusterLabel::Draw() const
+	void AdjusterLabel::Draw(RenderQueue* const renderQueue) const
 	{
-		m_Sprite->Draw();
+		m_Sprite->Draw(renderQueue);
 	}
 
 	string AdjusterLabel::CalculateMessage() const
@@ -2862,10 +3023,10 @@ namespace BlastOff
 		m_Label->Update();
 	}
 
-	void VolumeAdjuster::Draw() const
+	void VolumeAdjuster::Draw(RenderQueue* const renderQueue) const
 	{
-		m_SlideBar->Draw();
-		m_Label->Draw();
+		m_SlideBar->Draw(renderQueue);
+		m_Label->Draw(renderQueue);
 	}
 
 
@@ -2972,10 +3133,10 @@ namespace BlastOff
 		m_Label->Update();
 	}
 
-	void WindowSizeAdjuster::Draw() const
+	void WindowSizeAdjuster::Draw(RenderQueue* const renderQueue) const
 	{
-		m_SlideBar->Draw();
-		m_Label->Draw();
+		m_SlideBar->Draw(renderQueue);
+		m_Label->Draw(renderQueue);
 	}
 
 
@@ -3019,6 +3180,16 @@ namespace BlastOff
 		initializePosition();
 	}
 
+	vector<string> SaveButton::GetTexturePaths()
+	{
+		return
+		{
+			c_UnselectedTexturePath,
+			c_SelectedTexturePath,
+			c_ClickedTexturePath
+		};
+	}
+
 	const int SaveButton::c_ButtonIndex = 0;
 
 	const char* const SaveButton::c_UnselectedTexturePath = 
@@ -3112,6 +3283,16 @@ namespace BlastOff
 		initializePosition();
 	}
 
+	vector<string> CenterMenuExitButton::GetTexturePaths()
+	{
+		return
+		{
+			c_UnselectedTexturePath,
+			c_SelectedTexturePath,
+			c_ClickedTexturePath
+		};
+	}
+
 	const int CenterMenuExitButton::c_ButtonIndex = 1;
 
 	const char* const CenterMenuExitButton::c_UnselectedTexturePath = 
@@ -3364,6 +3545,8 @@ namespace BlastOff
 
 	void SettingsMenu::Update()
 	{
+		PROFILE_ZONE("SettingsMenu::Update");
+
 		const auto fadeIn = 
 			[this]()
 			{
@@ -3412,17 +3595,19 @@ namespace BlastOff
 		}
 	}
 
-	void SettingsMenu::Draw() const
+	void SettingsMenu::Draw(RenderQueue* const renderQueue) const
 	{
-		m_Backing->Draw();
+		PROFILE_ZONE("SettingsMenu::Draw");
+
+		m_Backing->Draw(renderQueue);
 		
 		for (const Adjuster* adjuster : m_Adjusters)
-			adjuster->Draw();
+			adjuster->Draw(renderQueue);
 	
 		for (const Button* button : m_Buttons)
-			button->Draw();
+			button->Draw(renderQueue);
 
-		m_ConfirmationDialogue->Draw();
+		m_ConfirmationDialogue->Draw(renderQueue);
 	}
 
 	void SettingsMenu::Apply()
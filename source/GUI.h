@@ -22,8 +22,12 @@ namespace BlastOff
 		float GetSmoothStatisticValue() const;
 		Vector2f GetEnergySpriteSize() const;
 
+		// snaps to the statistic again on the next update,
+		// instead of easing over from the old value
+		void Reset();
+
 		virtual void Update();
-		virtual void Draw() const;
+		virtual void Draw(RenderQueue* const renderQueue) const;
 
 	protected:
 		static const char* const c_BackingTexturePath;
@@ -68,6 +72,8 @@ namespace BlastOff
 			const Player* const player
 		);
 
+		static vector<string> GetTexturePaths();
+
 	private:
 		static const char* const c_EnergyTexturePath;
 
@@ -87,6 +93,8 @@ namespace BlastOff
 			const Player* const player
 		);
 
+		static vector<string> GetTexturePaths();
+
 	private:
 		static const char* const c_EnergyTexturePath;
 
@@ -104,7 +112,7 @@ namespace BlastOff
 		}
 
 		virtual void Update();
-		virtual void Draw() const;
+		virtual void Draw(RenderQueue* const renderQueue) const;
 
 	protected:
 		unique_ptr<TextLineSprite> m_Sprite;
@@ -172,7 +180,7 @@ namespace BlastOff
 		);
 
 		void Update();
-		void Draw() const;
+		void Draw(RenderQueue* const renderQueue) const;
 
 	private:
 		unique_ptr<BarLabelComponent> m_BackingLabel;
@@ -220,9 +228,14 @@ namespace BlastOff
 
 		virtual void Disable();
 		virtual void Enable();
+
+		// forgets the mouse, and ignores the next click
+		// the same way a new button would
+		virtual void Reset();
+
 		virtual void UpdateOpacity();
 		virtual void Update();
-		virtual void Draw() const;
+		virtual void Draw(RenderQueue* const renderQueue) const;
 
 	protected:
 		bool m_IsSelected = false;
@@ -238,9 +251,9 @@ namespace BlastOff
 		const InputManager* m_InputManager = nullptr;
 
 		const float* m_ParentOpacity = nullptr;
-		const Texture* m_UnselectedTexture = nullptr;
-		const Texture* m_SelectedTexture = nullptr;
-		const Texture* m_ClickedTexture = nullptr;
+		const TextureRegion* m_UnselectedTexture = nullptr;
+		const TextureRegion* m_SelectedTexture = nullptr;
+		const TextureRegion* m_ClickedTexture = nullptr;
 
 		Button(
 			const Callback& clickCallback,
@@ -270,6 +283,8 @@ namespace BlastOff
 			const ProgramConstants* const programConstants
 		);
 
+		static vector<string> GetTexturePaths();
+
 	protected:
 		static const int c_ButtonIndex;
 		
@@ -290,6 +305,8 @@ namespace BlastOff
 			const ProgramConstants* const programConstants
 		);
 
+		static vector<string> GetTexturePaths();
+
 	protected:
 		static const int c_ButtonIndex;
 
@@ -310,6 +327,8 @@ namespace BlastOff
 			const ProgramConstants* const programConstants
 		);
 
+		static vector<string> GetTexturePaths();
+
 	protected:
 		static const int c_ButtonIndex;
 		
@@ -353,7 +372,7 @@ namespace BlastOff
 
 		void UpdateOpacity();
 		void Update();
-		void Draw() const;
+		void Draw(RenderQueue* const renderQueue) const;
 
 	private:
 		const float* const m_ParentOpacity = nullptr;
@@ -377,6 +396,8 @@ namespace BlastOff
 		Vector2f GetStartingPosition() const;
 		bool HasJustFinished() const;
 		
+		// stops any slide, and puts the sprite back at the start
+		void Reset();
 		void Slide(const float waitInSeconds = 0);
 		void SwapPositions();
 		void Update();
@@ -410,7 +431,7 @@ namespace BlastOff
 
 		void Enable();
 		void Update();
-		void Draw() const;
+		void Draw(RenderQueue* const renderQueue) const;
 
 	private:
 		static const float c_SlideInWait;
@@ -429,7 +450,7 @@ namespace BlastOff
 		virtual void Disable();
 
 		virtual void Update();
-		void Draw() const;
+		void Draw(RenderQueue* const renderQueue) const;
 
 	protected:
 		static const float c_FontSize;
@@ -515,7 +536,9 @@ namespace BlastOff
 
         void SlideOut();
         void Update() override;
-        void Draw() const override;
+        void Draw(RenderQueue* const renderQueue) const override;
+
+        static vector<string> GetTexturePaths();
 
     protected:
 		static const int c_ButtonIndex;
@@ -545,6 +568,8 @@ namespace BlastOff
 
 		void SetParent(const Sprite* const parent);
 
+		static vector<string> GetTexturePaths();
+
 	protected:
 		static const char* const c_UnselectedTexturePath;
 		static const char* const c_SelectedTexturePath;
@@ -563,6 +588,7 @@ namespace BlastOff
 		);
 
 		void SlideOut();
+		void Reset() override;
 		void Update() override;
 	
 	protected:
@@ -589,8 +615,11 @@ namespace BlastOff
 		);
 		
 		void SlideOut();
+		void Reset() override;
 		void Update() override;
 
+		static vector<string> GetTexturePaths();
+
 	protected:
 		static const int c_ButtonIndexInGame;
 		static const int c_ButtonIndexInSettingsMenu;
@@ -615,6 +644,8 @@ namespace BlastOff
             const CameraEmpty* const cameraEmpty
 		);
 
+		static vector<string> GetTexturePaths();
+
 	protected:
 		static const char* const c_UnselectedTexturePath;
 		static const char* const c_SelectedTexturePath;
@@ -632,6 +663,8 @@ namespace BlastOff
             const CameraEmpty* const cameraEmpty
 		);
 
+		static vector<string> GetTexturePaths();
+
 	protected:
 		static const char* const c_UnselectedTexturePath;
 		static const char* const c_SelectedTexturePath;
@@ -649,6 +682,8 @@ namespace BlastOff
             const CameraEmpty* const cameraEmpty
 		);
 
+		static vector<string> GetTexturePaths();
+
 	protected:
 		static const char* const c_UnselectedTexturePath;
 		static const char* const c_SelectedTexturePath;
@@ -686,6 +721,8 @@ namespace BlastOff
 			const float* const parentOpacity = nullptr
 		);
 
+		static vector<string> GetTexturePaths();
+
 	private:
 		static const int c_ButtonIndex;
 		
@@ -715,8 +752,11 @@ namespace BlastOff
 
 		void Enable();
 
+		// hidden again, ready to slide in for the next outcome
+		void Reset();
+
 		virtual void Update();
-		virtual void Draw() const;
+		virtual void Draw(RenderQueue* const renderQueue) const;
 
 	private:
 		static const float c_Roundness;
@@ -792,7 +832,7 @@ namespace BlastOff
         );
 
         void Update();
-        void Draw() const;
+        void Draw(RenderQueue* const renderQueue) const;
 
     private:
         unique_ptr<Button> m_PlayButton = nullptr;
@@ -852,7 +892,7 @@ namespace BlastOff
 
 		void UpdateOpacity();
 		void Update();
-		void Draw() const;
+		void Draw(RenderQueue* const renderQueue) const;
 
 	protected:
 		void InitializeHandlePosition();
@@ -1011,7 +1051,7 @@ namespace BlastOff
 
 		void UpdateOpacity();
 		void Update();
-		void Draw() const;
+		void Draw(RenderQueue* const renderQueue) const;
 
 	protected:
 		virtual string FormatValue() const = 0;
@@ -1076,7 +1116,7 @@ namespace BlastOff
 
 		virtual void UpdateOpacity() = 0;
 		virtual void Update() = 0;
-		virtual void Draw() const = 0;
+		virtual void Draw(RenderQueue* const renderQueue) const = 0;
 
 		virtual ~SettingsMenuAdjuster()
 		{
@@ -1112,7 +1152,7 @@ namespace BlastOff
 		void OnApply(const float newValue);
 		void UpdateOpacity() override;
 		void Update() override;
-		void Draw() const override;
+		void Draw(RenderQueue* const renderQueue) const override;
 
 	private:
 		float m_UnappliedValue = 0;
@@ -1153,7 +1193,7 @@ namespace BlastOff
 		void OnApply(const float newValue);
 		void UpdateOpacity() override;
 		void Update() override;
-		void Draw() const override;
+		void Draw(RenderQueue* const renderQueue) const override;
 
 	private:
 		float m_UnappliedValue = 0;
@@ -1178,6 +1218,8 @@ namespace BlastOff
 			const float* const parentOpacity = nullptr
 		);
 
+		static vector<string> GetTexturePaths();
+
 	private:
 		static const int c_ButtonIndex;
 
@@ -1206,7 +1248,7 @@ namespace BlastOff
 		);
 
 		void Update();
-		void Draw() const;
+		void Draw(RenderQueue* const renderQueue) const;
 
 	private:
 		void Apply();
@@ -6,6 +6,7 @@
 #include "OperatingSystem.h"
 #include "Player.h"
 #include "Powerup.h"
+#include "Profiler.h"
 #include "Props.h"
 
 #include <memory>
@@ -14,33 +15,94 @@
 
 namespace BlastOff
 {
+	GamePopulation GamePopulation::Default()
+	{
+		const auto countIfEnabled =
+			[](const bool spawningEnabled, const size_t count) -> size_t
+			{
+				return spawningEnabled ? count : 0;
+			};
+
+		GamePopulation result;
+		result.speedUpPowerupCount = countIfEnabled(
+			SpeedUpPowerup::c_SpawningEnabled,
+			SpeedUpPowerup::c_Count
+		);
+		result.fuelUpPowerupCount = countIfEnabled(
+			FuelUpPowerup::c_SpawningEnabled,
+			FuelUpPowerup::c_Count
+		);
+		result.downforcePowerupCount = countIfEnabled(
+			DownforcePowerup::c_SpawningEnabled,
+			DownforcePowerup::c_Count
+		);
+		result.floatingPlatformCount = countIfEnabled(
+			FloatingPlatform::c_SpawningEnabled,
+			FloatingPlatform::c_Count
+		);
+		return result;
+	}
+
+
 	Game::Game(
 		const ProgramConstants* const programConstants,
 		ImageTextureLoader* const imageTextureLoader,
 		TextTextureLoader* const textTextureLoader,
-		Vector2f* const cameraPosition
+		Vector2f* const cameraPosition,
+		const GamePopulation& population,
+		const uint64_t seed
 	) :
 		m_ProgramConstants(programConstants),
 		m_CameraPosition(cameraPosition),
+		m_Population(population),
+		m_RandomStreams(seed),
+		m_Arena(c_ArenaSize),
+		m_FloatingPlatforms(m_Arena.GetResource()),
+		m_AllFloatingPlatforms(m_Arena.GetResource()),
 		m_ImageTextureLoader(imageTextureLoader),
 		m_TextTextureLoader(textTextureLoader)
 	{
 		
 	}
 
+	void Game::Reset(const uint64_t seed)
+	{
+		PROFILE_ZONE("Game::Reset");
+
+		m_Outcome = Outcome::None;
+		m_CullingStatistics = {};
+
+		m_RandomStreams.Reseed(seed);
+		m_InputManager->Reset(seed);
+
+		// the world keeps the size it was built with,
+		// so the crag, the spawn platform and the bounds stay put
+		SpawnObjects();
+
+		m_Player->Reset();
+		m_FuelBar->Reset();
+		m_SpeedupBar->Reset();
+	}
+
 	void Game::Update()
 	{
+		PROFILE_ZONE("Game::Update");
+
 		const auto calculateCameraOffset =
 			[](const float x) -> float
 			{
 				return -(powf(x, 1 / 3.0f) / 3);
 			};
 
-		const auto handlePowerupCollision =
-			[](Powerup* const powerup)
+		const auto findNearbyPowerups =
+			[this]() -> const vector<size_t>&
 			{
-				if (!powerup->IsCollected())
-					powerup->OnCollection();
+				const Rect2f playerRect = m_Player->GetEngineRect();
+				const float halfHeight = playerRect.h / 2.0f;
+				return m_PowerupIndex.Query(
+					playerRect.y - halfHeight, 
+					playerRect.y + halfHeight
+				);
 			};
 
 		const auto updateMiscObjects =
@@ -55,16 +117,14 @@ namespace BlastOff
 				m_FuelBarLabel->Update();
 				m_SpeedupBarLabel->Update();
 
-				for (Cloud* const cloud : m_AllClouds)
-					cloud->Update();
-
-				for (Powerup* const powerup : m_AllPowerups)
 				{
-					powerup->Update();
-
-					const bool collision = powerup->CollideWithPlayer();
-					if (collision)
-						handlePowerupCollision(powerup);
+					PROFILE_ZONE("Game::Update clouds");
+					m_Clouds->Update();
+				}
+				{
+					PROFILE_ZONE("Game::Update powerups");
+					m_Powerups->Update();
+					m_Powerups->CollideWithPlayer(findNearbyPowerups());
 				}
 
 				for (FloatingPlatform* const platform : m_AllFloatingPlatforms)
@@ -157,7 +217,7 @@ namespace BlastOff
 			[this]()
 			{
 				const int key = c_Constants.GetEmptyPlayerFuelKey();
-				const bool shouldEmptyFuel = IsKeyDown(key);
+				const bool shouldEmptyFuel = m_InputManager->GetKeyDown(key);
 				if (shouldEmptyFuel)
 					m_Player->EmptyFuel();
 			};
@@ -181,47 +241,99 @@ namespace BlastOff
 #endif
 	}
 
-	void Game::Draw() const
+	void Game::Draw(RenderQueue* const renderQueue) const
 	{
-		const auto drawCloud =
-			[this](const Cloud* const cloud, const bool isDrawingAfterPlayer)
+		PROFILE_ZONE("Game::Draw");
+
+		const Rect2f visibleRect = m_CoordTransformer->CalculateVisibleRect();
+		m_CullingStatistics = {};
+
+		// the world is far taller than the viewport,
+		// so most of these are nowhere near the camera
+		const auto isVisible =
+			[&, this](const auto* const object) -> bool
 			{
-				const bool drawsAbovePlayer = cloud->DrawsAbovePlayer();
-				if (drawsAbovePlayer == isDrawingAfterPlayer)
-					cloud->Draw();
+				if (!object->IsVisible(visibleRect))
+				{
+					m_CullingStatistics.culledCount++;
+					return false;
+				}
+				m_CullingStatistics.drawnCount++;
+				return true;
+			};
+
+		// the field picks each cloud's layer itself,
+		// and the queue sorts by layer, so the order here doesn't matter
+		const auto drawClouds =
+			[&, this]()
+			{
+				const size_t drawnCount =
+				{
+					m_Clouds->Draw(renderQueue, visibleRect)
+				};
+				m_CullingStatistics.drawnCount += drawnCount;
+				m_CullingStatistics.culledCount +=
+					m_Clouds->GetCount() - drawnCount;
+			};
+
+		const auto drawPowerups =
+			[&, this]()
+			{
+				const size_t drawnCount =
+				{
+					m_Powerups->Draw(renderQueue, visibleRect)
+				};
+				m_CullingStatistics.drawnCount += drawnCount;
+				m_CullingStatistics.culledCount +=
+					m_Powerups->GetCount() - drawnCount;
 			};
 
 		const auto drawObjects =
 			[&, this]()
 			{
-				m_Background->Draw();
-				m_Crag->Draw();
-				m_Platform->Draw();
+				renderQueue->SetLayer(RenderLayer::Background);
+				m_Background->Draw(renderQueue);
+
+				renderQueue->SetLayer(RenderLayer::Terrain);
+				m_Crag->Draw(renderQueue);
+				m_Platform->Draw(renderQueue);
 
-				for (const Cloud* const cloud : m_AllClouds)
-					drawCloud(cloud, false);
+				drawClouds();
 				
-				for (const Powerup* const powerup : m_AllPowerups)
-					powerup->Draw();
+				renderQueue->SetLayer(RenderLayer::Powerups);
+				drawPowerups();
 
+				renderQueue->SetLayer(RenderLayer::Platforms);
 				const auto& vector = m_AllFloatingPlatforms;
 				for (const FloatingPlatform* const platform : vector)
-					platform->Draw();
+				{
+					if (isVisible(platform))
+						platform->Draw(renderQueue);
+				}
 
-				m_Player->Draw();
-				
-				for (const Cloud* const cloud : m_AllClouds)
-					drawCloud(cloud, true);
+				renderQueue->SetLayer(RenderLayer::Player);
+				m_Player->Draw(renderQueue);
 
-				m_FuelBar->Draw();
-				m_SpeedupBar->Draw();
-				m_FuelBarLabel->Draw();
-				m_SpeedupBarLabel->Draw();
+				renderQueue->SetLayer(RenderLayer::Interface);
+				m_FuelBar->Draw(renderQueue);
+				m_SpeedupBar->Draw(renderQueue);
+				m_FuelBarLabel->Draw(renderQueue);
+				m_SpeedupBarLabel->Draw(renderQueue);
 			};
 
 		drawObjects();
 	}
 
+	GameOutcome Game::GetOutcome() const
+	{
+		return m_Outcome;
+	}
+
+	const CullingStatistics& Game::GetCullingStatistics() const
+	{
+		return m_CullingStatistics;
+	}
+
 	void Game::ChooseOutcome(const Outcome outcome)
 	{
 		m_Outcome = outcome;
@@ -254,7 +366,7 @@ namespace BlastOff
 					0, backgroundY,
 					viewportSize.x, worldBoundHeight
 				};
-				m_Background = std::make_unique<Background>(
+				m_Background = m_Arena.Create<Background>(
 					&m_WorldBounds,
 					m_CoordTransformer,
 					m_ProgramConstants
@@ -264,7 +376,7 @@ namespace BlastOff
 		const auto initializeCrag =
 			[&, this]()
 			{
-				m_Crag = std::make_unique<Crag>(
+				m_Crag = m_Arena.Create<Crag>(
 					m_CoordTransformer,
 					m_ProgramConstants,
 					m_ImageTextureLoader
@@ -275,7 +387,7 @@ namespace BlastOff
 			[&, this]()
 			{
 				const float platformHeight = c_Constants.GetPlatformHeight();
-				m_Platform = std::make_unique<SpawnPlatform>(
+				m_Platform = m_Arena.Create<SpawnPlatform>(
 					platformHeight,
 					m_CoordTransformer,
 					m_ProgramConstants,
@@ -283,137 +395,199 @@ namespace BlastOff
 				);
 			};
 
-		const auto initializeFloatingPlatforms = 
+		// filled in by SpawnObjects(), which also picks the direction
+		const auto initializeCloudField =
+			[this]()
+			{
+				m_Clouds = m_Arena.Create<CloudField>(
+					m_CoordTransformer,
+					m_ProgramConstants,
+					m_ImageTextureLoader,
+					m_RandomStreams.Get(RandomStreamType::Clouds),
+					&m_WorldBounds,
+					m_CloudMovementDirection,
+					&m_Arena
+				);
+			};
+
+		const auto initializePlayer =
 			[&, this]()
 			{
-				if (!FloatingPlatform::c_SpawningEnabled)
-					return;
+				m_Player = m_Arena.Create<Player>(
+					&m_Outcome,
+					&m_WorldBounds,
+					m_Platform,
+					&m_AllFloatingPlatforms,
+					&m_FloatingPlatformIndex,
+					m_CoordTransformer,
+					&c_Constants,
+					m_ProgramConstants,
+					m_InputManager.get(),
+					m_ImageTextureLoader,
+					m_RandomStreams.Get(RandomStreamType::Player),
+					m_RandomStreams.Get(RandomStreamType::Effects)
+				);
+			};
 
-				const size_t length = FloatingPlatform::c_Count;
-				m_FloatingPlatforms.reserve(length);
-				for (size_t index = 0; index < length; index++)
-				{
-					(void)index;
-					m_FloatingPlatforms.emplace_back(
-						m_CoordTransformer,
-						m_ProgramConstants,
-						m_ImageTextureLoader
-					);
-				}
+		const auto updatePlatformCollisionRect =
+			[this]()
+			{
+				const Rect2f playerRect = m_Player->GetEngineRect();
+				const Vector2f playerSize = playerRect.GetSize();
 
-				m_AllFloatingPlatforms.reserve(length);
-				for (FloatingPlatform& platform : m_FloatingPlatforms)
-					m_AllFloatingPlatforms.push_back(&platform);
+				m_Platform->UpdateCollisionRect(playerSize);
 			};
 
-		const auto initializeCloudDirection =
+		const auto initializePowerupField =
 			[this]()
 			{
-				const float x = GetRandomFloat();
-				if (x > 0.5f)
-					m_CloudMovementDirection = Direction::Right;
-				else
-					m_CloudMovementDirection = Direction::Left;
+				m_Powerups = m_Arena.Create<PowerupField>(
+					m_CoordTransformer,
+					m_ProgramConstants,
+					m_Player,
+					m_ImageTextureLoader,
+					&m_Arena
+				);
 			};
 
-		const auto initializeCloud =
-			[&, this](auto& vector)
+		const auto initializeGUIBars =
+			[&, this]()
 			{
-				vector.emplace_back(
+				m_FuelBar = m_Arena.Create<FuelBar>(
 					m_CoordTransformer,
 					m_ProgramConstants,
 					m_ImageTextureLoader,
-					&m_WorldBounds,
-					&m_CloudMovementDirection
+					m_CameraEmpty,
+					m_Player
+				);
+				m_SpeedupBar = m_Arena.Create<SpeedupBar>(
+					m_CoordTransformer,
+					m_ProgramConstants,
+					m_ImageTextureLoader,
+					m_CameraEmpty,
+					m_Player
 				);
 			};
 
-		const auto initializeLowClouds =
+		const auto initializeGUILabels =
 			[&, this]()
 			{
-				const size_t length = c_Constants.GetAmountOfLowClouds();
-				m_LowClouds.reserve(length);
-
-				for (size_t index = 0; index < length; index++)
-					initializeCloud(m_LowClouds);
+				m_FuelBarLabel = m_Arena.Create<FuelBarLabel>(
+					m_FuelBar,
+					m_CoordTransformer,
+					m_ProgramConstants,
+					m_TextTextureLoader
+				);
+				m_SpeedupBarLabel = m_Arena.Create<SpeedupBarLabel>(
+					m_SpeedupBar,
+					m_CoordTransformer,
+					m_ProgramConstants,
+					m_TextTextureLoader
+				);
 			};
 
-		const auto initializeHighClouds =
-			[&, this]()
+		const auto initializeObjects =
+			[&]()
 			{
-				const size_t length = c_Constants.GetAmountOfLowClouds();
-				m_HighClouds.reserve(length);
+				initializeBackgroundSprite();
+				initializeCrag();
+				initializeSpawnPlatform();
+				initializeCloudField();
+				initializePlayer();
+				initializePowerupField();
+				initializeGUIBars();
+				initializeGUILabels();
 
-				for (size_t index = 0; index < length; index++)
-					initializeCloud(m_HighClouds);
+				SpawnObjects();
 			};
 
-		const auto initializeAllCloudsVector =
+		m_CoordTransformer = coordTransformer;
+		m_CameraEmpty = cameraEmpty;
+		m_InputManager = std::move(inputManager);
+
+		initializeObjects();
+		updatePlatformCollisionRect();
+	}
+
+	void Game::SpawnObjects()
+	{
+		const auto spawnFloatingPlatforms = 
 			[this]()
 			{
-				const size_t totalLength =
+				const size_t length = m_Population.floatingPlatformCount;
+				if (!length)
+					return;
+
+				RandomStream* const random =
 				{
-					m_LowClouds.size() + m_HighClouds.size()
+					m_RandomStreams.Get(RandomStreamType::FloatingPlatforms)
 				};
-				m_AllClouds.reserve(totalLength);
-
-				for (Cloud& cloud : m_LowClouds)
-					m_AllClouds.push_back(&cloud);
-				for (Cloud& cloud : m_HighClouds)
-					m_AllClouds.push_back(&cloud);
-			};
-
-		const auto initializeClouds =
-			[&]()
-			{
-				initializeCloudDirection();
+				for (FloatingPlatform& platform : m_FloatingPlatforms)
+					platform.Respawn(random);
 
-				initializeLowClouds();
-				initializeHighClouds();
+				m_FloatingPlatforms.reserve(length);
+				while (m_FloatingPlatforms.size() < length)
+				{
+					m_FloatingPlatforms.emplace_back(
+						m_CoordTransformer,
+						m_ProgramConstants,
+						m_ImageTextureLoader,
+						random
+					);
+				}
 
-				initializeAllCloudsVector();	
+				m_AllFloatingPlatforms.clear();
+				m_AllFloatingPlatforms.reserve(length);
+				for (FloatingPlatform& platform : m_FloatingPlatforms)
+					m_AllFloatingPlatforms.push_back(&platform);
 			};
 
-		const auto initializePlayer =
-			[&, this]()
+		const auto chooseCloudDirection =
+			[this]()
 			{
-				m_Player = std::make_unique<Player>(
-					&m_Outcome,
-					&m_WorldBounds,
-					m_Platform.get(),
-					&m_AllFloatingPlatforms,
-					m_CoordTransformer,
-					&c_Constants,
-					m_ProgramConstants,
-					m_InputManager.get(),
-					m_ImageTextureLoader
-				);
+				RandomStream* const random =
+				{
+					m_RandomStreams.Get(RandomStreamType::Clouds)
+				};
+				const float x = random->NextFloat();
+				if (x > 0.5f)
+					m_CloudMovementDirection = Direction::Right;
+				else
+					m_CloudMovementDirection = Direction::Left;
 			};
 
-		const auto updatePlatformCollisionRect =
-			[this]()
+		const auto spawnClouds =
+			[&, this]()
 			{
-				const Rect2f playerRect = m_Player->GetEngineRect();
-				const Vector2f playerSize = playerRect.GetSize();
+				chooseCloudDirection();
+				m_Clouds->Clear(m_CloudMovementDirection);
 
-				m_Platform->UpdateCollisionRect(playerSize);
+				const size_t lowCount = c_Constants.GetAmountOfLowClouds();
+				const size_t highCount = c_Constants.GetAmountOfHighClouds();
+				m_Clouds->Add(CloudKind::c_Low, lowCount);
+				m_Clouds->Add(CloudKind::c_High, highCount);
 			};
 
+		// takes two of the pre-generated numbers
 		const auto calculateRandomOffset =
-			[this](const float randomYRange) -> Vector2f
+			[this](
+				const float* const randomNumbers, 
+				const float randomYRange
+			) -> Vector2f
 			{
 				return
 				{
-					(GetRandomFloat() - 0.5f) * m_WorldBounds.w,
-					GetRandomFloat() * randomYRange
+					(randomNumbers[0] - 0.5f) * m_WorldBounds.w,
+					randomNumbers[1] * randomYRange
 				};
 			};
 
-		const auto initializePowerup =
+		const auto spawnPowerup =
 			[&](
 				const size_t index,
 				const size_t length,
-				auto& vector
+				const float* const randomNumbers,
+				auto& pool
 			)
 			{
 				constexpr float randomness = 2;
@@ -438,7 +612,7 @@ namespace BlastOff
 
 				const Vector2f randomOffset =
 				{
-					calculateRandomOffset(randomYRange)
+					calculateRandomOffset(randomNumbers, randomYRange)
 				};
 				const Vector2f enginePosition = bottomOfRange + randomOffset;
 #if COMPILE_CONFIG_DEBUG
@@ -456,128 +630,103 @@ namespace BlastOff
 					BreakProgram();
 				}
 #endif
-				vector.emplace_back(
-					m_CoordTransformer,
-					m_ProgramConstants,
-					m_Player.get(),
-					m_ImageTextureLoader,
-					enginePosition
-				);
+				pool.Add(enginePosition);
 			};
 
-		const auto initializePowerupVector =
-			[&](const size_t length, auto& vector, size_t* totalLength)
+		const auto spawnPowerupPool =
+			[&, this](const size_t length, auto& pool)
 			{
-				vector.reserve(length);
+				// generate every offset for this vector in one batch
+				constexpr size_t numbersPerPowerup = 2;
+				std::vector<float> randomNumbers(length * numbersPerPowerup);
 
-				for (size_t index = 0; index < length; index++)
-					initializePowerup(index, length, vector);
-
-				*totalLength += length;
-			};
-
-		const auto registerPowerupVector =
-			[this](auto& vector)
-			{
-				for (Powerup& powerup : vector)
-					m_AllPowerups.push_back(&powerup);
-			};
-
-		const auto initializePowerups =
-			[&]()
-			{
-				size_t totalLength = 0;
-				if (SpeedUpPowerup::c_SpawningEnabled)
-				{
-					const size_t length = SpeedUpPowerup::c_Count;
-					initializePowerupVector(
-						length, 
-						m_SpeedUpPowerups, 
-						&totalLength
-					);
-				}
-				if (FuelUpPowerup::c_SpawningEnabled)
+				RandomStream* const random =
 				{
-					const size_t length = FuelUpPowerup::c_Count;
-					initializePowerupVector(
-						length, 
-						m_FuelUpPowerups, 
-						&totalLength
-					);
-				}
-				if (DownforcePowerup::c_SpawningEnabled) 
+					m_RandomStreams.Get(RandomStreamType::Powerups)
+				};
+				random->FillFloats(randomNumbers.data(), randomNumbers.size());
+
+				pool.Reserve(length);
+				for (size_t index = 0; index < length; index++)
 				{
-					const size_t length = DownforcePowerup::c_Count;
-					initializePowerupVector(
-						length, 
-						m_DownforcePowerups, 
-						&totalLength
-					);
+					const float* const numbers =
+					{
+						randomNumbers.data() + (index * numbersPerPowerup)
+					};
+					spawnPowerup(index, length, numbers, pool);
 				}
-
-				m_AllPowerups.reserve(totalLength);
-
-				registerPowerupVector(m_SpeedUpPowerups);
-				registerPowerupVector(m_FuelUpPowerups);
-				registerPowerupVector(m_DownforcePowerups);
 			};
 
-		const auto initializeGUIBars =
+		const auto spawnPowerups =
 			[&, this]()
 			{
-				m_FuelBar = std::make_unique<FuelBar>(
-					m_CoordTransformer,
-					m_ProgramConstants,
-					m_ImageTextureLoader,
-					m_CameraEmpty,
-					m_Player.get()
+				m_Powerups->Clear();
+
+				spawnPowerupPool(
+					m_Population.speedUpPowerupCount, 
+					m_Powerups->GetPool<SpeedUpPowerup>()
 				);
-				m_SpeedupBar = std::make_unique<SpeedupBar>(
-					m_CoordTransformer,
-					m_ProgramConstants,
-					m_ImageTextureLoader,
-					m_CameraEmpty,
-					m_Player.get()
+				spawnPowerupPool(
+					m_Population.fuelUpPowerupCount, 
+					m_Powerups->GetPool<FuelUpPowerup>()
+				);
+				spawnPowerupPool(
+					m_Population.downforcePowerupCount, 
+					m_Powerups->GetPool<DownforcePowerup>()
 				);
 			};
 
-		const auto initializeGUILabels =
-			[&, this]()
+		const auto buildIndex =
+			[this](
+				VerticalIndex* const verticalIndex,
+				const size_t count, 
+				const auto& calculateBounds
+			)
 			{
-				m_FuelBarLabel = std::make_unique<FuelBarLabel>(
-					m_FuelBar.get(),
-					m_CoordTransformer,
-					m_ProgramConstants,
-					m_TextTextureLoader
-				);
-				m_SpeedupBarLabel = std::make_unique<SpeedupBarLabel>(
-					m_SpeedupBar.get(),
-					m_CoordTransformer,
-					m_ProgramConstants,
-					m_TextTextureLoader
+				verticalIndex->Reset(
+					GetWorldEdge(Direction::Down),
+					GetWorldEdge(Direction::Up),
+					c_IndexBucketHeight
 				);
+				for (size_t index = 0; index < count; index++)
+				{
+					const Rect2f bounds = calculateBounds(index);
+					const float halfHeight = bounds.h / 2.0f;
+					verticalIndex->Insert(
+						index, 
+						bounds.y - halfHeight, 
+						bounds.y + halfHeight
+					);
+				}
 			};
 
-		const auto initializeObjects =
-			[&]()
+		const auto buildIndices =
+			[&, this]()
 			{
-				initializeBackgroundSprite();
-				initializeCrag();
-				initializeSpawnPlatform();
-				initializeFloatingPlatforms();
-				initializeClouds();
-				initializePlayer();
-				initializePowerups();
-				initializeGUIBars();
-				initializeGUILabels();
+				buildIndex(
+					&m_PowerupIndex,
+					m_Powerups->GetCount(),
+					[this](const size_t index)
+					{
+						return m_Powerups->CalculateBounds(index);
+					}
+				);
+				buildIndex(
+					&m_FloatingPlatformIndex,
+					m_AllFloatingPlatforms.size(),
+					[this](const size_t index)
+					{
+						return m_FloatingPlatforms.at(index).CalculateBounds();
+					}
+				);
 			};
 
-		m_CoordTransformer = coordTransformer;
-		m_CameraEmpty = cameraEmpty;
-		m_InputManager = std::move(inputManager);
+		spawnFloatingPlatforms();
+		spawnClouds();
+		spawnPowerups();
 
-		initializeObjects();
-		updatePlatformCollisionRect();
+		// nothing indexed moves once it's spawned
+		buildIndices();
 	}
 
 	float Game::GetWorldEdge(const Direction side) const
@@ -619,6 +768,12 @@ namespace BlastOff
 		return false;
 	}
 
+	const float Game::c_IndexBucketHeight = 8;
+
+	// enough for everything a default game makes, with room to spare.
+	// anything past it just goes in another block
+	const size_t Game::c_ArenaSize = 64 * 1024;
+
 
 	PlayableGame::PlayableGame(
         const bool* const programIsMuted,
@@ -630,13 +785,18 @@ namespace BlastOff
         const Callback& resetCallback,
 		const Callback& exitCallback,
         const Vector2i* const windowPosition,
-        const Vector2i* const windowSize
+        const Vector2i* const windowSize,
+		const InputManagerFactory& inputManagerFactory,
+		const GamePopulation& population,
+		const uint64_t seed
     ) :
         Game(
             programConstants,
             imageTextureLoader,
             textTextureLoader,
-			&m_CameraPosition
+			&m_CameraPosition,
+			population,
+			seed
         )
     {
 		const auto initializeGraphics =
@@ -674,7 +834,7 @@ namespace BlastOff
                 const auto coordTransformer = m_CoordinateTransformer.get();
                 unique_ptr<InputManager> inputManager =
                 {
-                    std::make_unique<PlayableInputManager>(coordTransformer)
+                    inputManagerFactory(coordTransformer)
                 };
                 FinishConstruction(
 					m_CoordinateTransformer.get(),
@@ -686,7 +846,7 @@ namespace BlastOff
 		const auto initializeGameEndMenus =
 			[&, this]()
 			{
-				m_WinMenu = std::make_unique<WinMenu>(
+				m_WinMenu = m_Arena.Create<WinMenu>(
 					resetCallback,
 					exitCallback,
 					m_CoordinateTransformer.get(),
@@ -696,7 +856,7 @@ namespace BlastOff
 					textTextureLoader,
 					m_CameraEmpty.get()
 				);
-				m_LoseMenu = std::make_unique<LoseMenu>(
+				m_LoseMenu = m_Arena.Create<LoseMenu>(
 					resetCallback,
 					exitCallback,
 					m_CoordinateTransformer.get(),
@@ -711,7 +871,7 @@ namespace BlastOff
 		const auto initializeGUIButtons =
 			[&, this]()
 			{
-                m_MuteButton = std::make_unique<MuteButton>(
+                m_MuteButton = m_Arena.Create<MuteButton>(
 					programIsMuted,
 					m_CoordinateTransformer.get(),
 					m_InputManager.get(),
@@ -720,7 +880,7 @@ namespace BlastOff
                     muteUnmuteUnmuteCallback,
                     m_CameraEmpty.get()
                 );
-				m_ResetButton = std::make_unique<TopRightResetButton>(
+				m_ResetButton = m_Arena.Create<TopRightResetButton>(
 					m_CoordinateTransformer.get(),
 					m_InputManager.get(),
 					m_ProgramConstants,
@@ -728,7 +888,7 @@ namespace BlastOff
 					resetCallback,
 					m_CameraEmpty.get()
 				);
-				m_ExitButton = std::make_unique<TopRightExitButton>(
+				m_ExitButton = m_Arena.Create<TopRightExitButton>(
 					m_CoordinateTransformer.get(),
 					m_InputManager.get(),
 					m_ProgramConstants,
@@ -746,6 +906,32 @@ namespace BlastOff
         initializeGUIButtons();
     }
 
+    void PlayableGame::Reset(const uint64_t seed)
+    {
+        const auto resetCamera =
+            [this]()
+            {
+                m_CameraPosition = Vector2f::Zero();
+                m_CoordinateTransformer->Update();
+                m_CameraEmpty->Update();
+            };
+
+        const auto resetMiscObjects =
+            [this]()
+            {
+                m_WinMenu->Reset();
+                m_LoseMenu->Reset();
+                m_MuteButton->Reset();
+                m_ResetButton->Reset();
+                m_ExitButton->Reset();
+            };
+
+        Game::Reset(seed);
+
+        resetCamera();
+        resetMiscObjects();
+    }
+
     void PlayableGame::Update()
     {
         const auto updateMiscObjects =
@@ -763,19 +949,18 @@ namespace BlastOff
         updateMiscObjects();
     }
 
-    void PlayableGame::Draw() const
+    void PlayableGame::Draw(RenderQueue* const renderQueue) const
     {
-        Game::Draw();
-
-        // TODO: if the PlayableGame class ever needs to draw something
-        // below ANYTHING in the Game class, this will literally not be
-        // possible.
-        // a fix may be needed eventually
-        m_WinMenu->Draw();
-        m_LoseMenu->Draw();
-        m_MuteButton->Draw();
-        m_ResetButton->Draw();
-		m_ExitButton->Draw();
+        Game::Draw(renderQueue);
+
+        // anything here can go below the Game class's objects
+        // by picking a lower layer
+        renderQueue->SetLayer(RenderLayer::Menus);
+        m_WinMenu->Draw(renderQueue);
+        m_LoseMenu->Draw(renderQueue);
+        m_MuteButton->Draw(renderQueue);
+        m_ResetButton->Draw(renderQueue);
+		m_ExitButton->Draw(renderQueue);
     }
 
     void PlayableGame::ChooseOutcome(const Outcome outcome)
@@ -787,7 +972,11 @@ namespace BlastOff
 				if (!isSoundEnabled)
 					return;
 
-				const float easterEggTest = GetRandomFloat();
+				RandomStream* const random =
+				{
+					m_RandomStreams.Get(RandomStreamType::Effects)
+				};
+				const float easterEggTest = random->NextFloat();
 
 				if (easterEggTest < powf(10, -3))
 					PlaySound(*m_EasterEggSound2);
@@ -806,10 +995,10 @@ namespace BlastOff
 				switch (m_Outcome)
 				{
 					case Outcome::Winner:
-						return m_WinMenu.get();
+						return m_WinMenu;
 
 					case Outcome::Loser:
-						return m_LoseMenu.get();
+						return m_LoseMenu;
 
 					case Outcome::None:
 					default:
@@ -836,14 +1025,20 @@ namespace BlastOff
 		ImageTextureLoader* const imageTextureLoader,
 		TextTextureLoader* const textTextureLoader,
 		Vector2f* const cameraPosition,
-		const Callback& resetCallback
+		OutcomeStatistics* const outcomeStatistics,
+		const Callback& resetCallback,
+		const GamePopulation& population,
+		const uint64_t seed
 	) :
 		Game(
 			programConstants,
 			imageTextureLoader,
 			textTextureLoader,
-			cameraPosition
+			cameraPosition,
+			population,
+			seed
 		),
+		m_OutcomeStatistics(outcomeStatistics),
 		m_ResetCallback(resetCallback)
 	{
 		unique_ptr<InputManager> inputManager =
@@ -851,7 +1046,8 @@ namespace BlastOff
 			std::make_unique<CutsceneInputManager>(
 				coordTransformer,
 				cameraPosition,
-				m_ProgramConstants
+				m_ProgramConstants,
+				m_RandomStreams.Get(RandomStreamType::Input)
 			)
 		};
 		FinishConstruction(
@@ -861,6 +1057,13 @@ namespace BlastOff
 		);
 	}
 
+	void Cutscene::Reset(const uint64_t seed)
+	{
+		Game::Reset(seed);
+
+		m_ResetTick = c_DeactivatedTick;
+	}
+
 	void Cutscene::Update()
 	{
 		const auto updateResetTimer =
@@ -903,12 +1106,12 @@ namespace BlastOff
 					case Outcome::Winner:
 						if (c_PrintOutcomeStatistics)
 							Logging::Log("game won");
-						return &m_WinCount;
+						return &m_OutcomeStatistics->winCount;
 
 					case Outcome::Loser:
 						if (c_PrintOutcomeStatistics)
 							Logging::Log("game lost");
-						return &m_LossCount;
+						return &m_OutcomeStatistics->lossCount;
 
 					default:
 						return nullptr;
@@ -929,18 +1132,21 @@ namespace BlastOff
 
 				if (!c_PrintOutcomeStatistics)
 					return;
-				if (!(m_WinCount + m_LossCount))
+
+				const uint64_t winCount = m_OutcomeStatistics->winCount;
+				const uint64_t lossCount = m_OutcomeStatistics->lossCount;
+				if (!(winCount + lossCount))
 					return;
 
 				string message = "";
-				const float ratio = m_WinCount / (float)(m_WinCount + m_LossCount);
+				const float ratio = winCount / (float)(winCount + lossCount);
 				
 				std::print("\n");
 				
-				message = std::format("Win count: {}", m_WinCount);
+				message = std::format("Win count: {}", winCount);
 				Logging::Log(message.c_str());
 
-				message = std::format("Loss count: {}", m_LossCount);
+				message = std::format("Loss count: {}", lossCount);
 				Logging::Log(message.c_str());
 
 				std::print("\n");
@@ -953,7 +1159,8 @@ namespace BlastOff
 	
 		Game::ChooseOutcome(outcome);
 
-		trackOutcomeStatistics();
+		if (m_OutcomeStatistics)
+			trackOutcomeStatistics();
 		
 		if (c_PrintOutcomeStatistics)
 			m_ResetCallback();
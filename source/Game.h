@@ -9,20 +9,54 @@
 #include "Powerup.h"
 #include "GUI.h"
 #include "Sound.h"
+#include "Random.h"
+#include "VerticalIndex.h"
+#include "Arena.h"
 
 namespace BlastOff
 {
+	// how many of each spawnable object a game creates.
+	// zero means that object doesn't spawn at all
+	struct GamePopulation
+	{
+		size_t speedUpPowerupCount = 0;
+		size_t fuelUpPowerupCount = 0;
+		size_t downforcePowerupCount = 0;
+		size_t floatingPlatformCount = 0;
+
+		// taken from each object's own constants
+		static GamePopulation Default();
+	};
+
+	// how many of the culled kinds of object 
+	// the most recent Draw() skipped, and how many it drew
+	struct CullingStatistics
+	{
+		size_t drawnCount = 0;
+		size_t culledCount = 0;
+	};
+
 	struct Game
 	{
 		Game(
             const ProgramConstants* const programConstants,
 			ImageTextureLoader* const imageTextureLoader,
 			TextTextureLoader* const textTextureLoader,
-			Vector2f* const cameraPosition
+			Vector2f* const cameraPosition,
+			const GamePopulation& population,
+			const uint64_t seed
         );
 
+		// starts the game over with a new seed, keeping every object
+		// and texture it already has, and only spawning things again.
+		// plays out the same as a new game with that seed
+		virtual void Reset(const uint64_t seed);
+
 		virtual void Update();
-		virtual void Draw() const;
+		virtual void Draw(RenderQueue* const renderQueue) const;
+
+		GameOutcome GetOutcome() const;
+		const CullingStatistics& GetCullingStatistics() const;
 
 	private:		
 		CoordinateTransformer* m_CoordTransformer = nullptr;
@@ -41,41 +75,62 @@ namespace BlastOff
 			unique_ptr<InputManager> inputManager
 		);
 
+		// everything placed at random, in the order the streams expect.
+		// objects already spawned are moved rather than recreated
+		void SpawnObjects();
+
 		float GetWorldEdge(const Direction side) const;
 		bool LosingConditionsAreSatisfied() const;
 
 		static const inline Constants c_Constants;
 
+		// around twice the viewport's height, 
+		// so a query rarely reaches past two buckets
+		static const float c_IndexBucketHeight;
+
+		static const size_t c_ArenaSize;
+
 		Outcome m_Outcome = Outcome::None;
 		Direction m_CloudMovementDirection = Direction::None;
 		Rect2f m_WorldBounds = Rect2f::UnitRect();
 
+		GamePopulation m_Population = {};
+		RandomStreams m_RandomStreams;
+
 		unique_ptr<InputManager> m_InputManager = nullptr;
 
-		unique_ptr<Background> m_Background = nullptr;
-		unique_ptr<Crag> m_Crag = nullptr;
-		unique_ptr<SpawnPlatform> m_Platform = nullptr;
-		unique_ptr<Player> m_Player = nullptr;
-		unique_ptr<GUIBar> m_FuelBar = nullptr;
-		unique_ptr<GUIBar> m_SpeedupBar = nullptr;
-		unique_ptr<BarLabel> m_FuelBarLabel = nullptr;
-		unique_ptr<BarLabel> m_SpeedupBarLabel = nullptr;
-
-		vector<SpeedUpPowerup> m_SpeedUpPowerups = {};
-		vector<FuelUpPowerup> m_FuelUpPowerups = {};
-		vector<DownforcePowerup> m_DownforcePowerups = {};
-		vector<FloatingPlatform> m_FloatingPlatforms = {};
-		vector<LowCloud> m_LowClouds = {};
-		vector<HighCloud> m_HighClouds = {};
-
-		vector<Powerup*> m_AllPowerups = {};
-		vector<Cloud*> m_AllClouds = {};
-		vector<FloatingPlatform*> m_AllFloatingPlatforms = {};
+		// owns the world and the HUD, so they sit together in memory,
+		// and all go at once when the game does.
+		// declared before them, so it outlives them
+		Arena m_Arena;
+
+		Background* m_Background = nullptr;
+		Crag* m_Crag = nullptr;
+		SpawnPlatform* m_Platform = nullptr;
+		Player* m_Player = nullptr;
+		GUIBar* m_FuelBar = nullptr;
+		GUIBar* m_SpeedupBar = nullptr;
+		BarLabel* m_FuelBarLabel = nullptr;
+		BarLabel* m_SpeedupBarLabel = nullptr;
+		CloudField* m_Clouds = nullptr;
+		PowerupField* m_Powerups = nullptr;
+
+		ArenaVector<FloatingPlatform> m_FloatingPlatforms;
+
+		ArenaVector<FloatingPlatform*> m_AllFloatingPlatforms;
+
+		// by height, over the world bounds. 
+		// the items are indices into m_Powerups and m_FloatingPlatforms
+		VerticalIndex m_PowerupIndex = {};
+		VerticalIndex m_FloatingPlatformIndex = {};
 
 		const ProgramConstants* m_ProgramConstants = nullptr;
 
 		ImageTextureLoader* m_ImageTextureLoader = nullptr;
 		TextTextureLoader* m_TextTextureLoader = nullptr;
+
+		// written by Draw(), so it's only ever about the last frame
+		mutable CullingStatistics m_CullingStatistics = {};
 	};
 
 	struct PlayableGame : public Game
@@ -90,13 +145,17 @@ namespace BlastOff
 			const Callback& resetCallback,
 			const Callback& exitCallback,
 			const Vector2i* const windowPosition,
-			const Vector2i* const windowSize
+			const Vector2i* const windowSize,
+			const InputManagerFactory& inputManagerFactory,
+			const GamePopulation& population,
+			const uint64_t seed
 		);
 
 		void ChooseOutcome(const Outcome outcome) override;
 
+		void Reset(const uint64_t seed) override;
 		void Update() override;
-		void Draw() const override;
+		void Draw(RenderQueue* const renderQueue) const override;
 
 	protected:
 		Vector2f m_CameraPosition = Vector2f::Zero();
@@ -104,11 +163,12 @@ namespace BlastOff
 		unique_ptr<CameraEmpty> m_CameraEmpty = nullptr;
 		unique_ptr<CoordinateTransformer> m_CoordinateTransformer = nullptr;
 
-		unique_ptr<GameEndMenu> m_WinMenu = nullptr;
-		unique_ptr<GameEndMenu> m_LoseMenu = nullptr;
-		unique_ptr<MuteButton> m_MuteButton = nullptr;
-		unique_ptr<TopRightResetButton> m_ResetButton = nullptr;
-		unique_ptr<TopRightExitButton> m_ExitButton = nullptr;
+		// made in the game's arena, along with the rest of the HUD
+		GameEndMenu* m_WinMenu = nullptr;
+		GameEndMenu* m_LoseMenu = nullptr;
+		MuteButton* m_MuteButton = nullptr;
+		TopRightResetButton* m_ResetButton = nullptr;
+		TopRightExitButton* m_ExitButton = nullptr;
 
 		const Sound* m_WinSound = nullptr;
 		const Sound* m_LoseSound = nullptr;
@@ -116,6 +176,13 @@ namespace BlastOff
 		const Sound* m_EasterEggSound2 = nullptr;
 	};
 
+	// outlives each Cutscene, so the counts survive it being recreated
+	struct OutcomeStatistics
+	{
+		uint64_t winCount = 0;
+		uint64_t lossCount = 0;
+	};
+
 	struct Cutscene : public Game
 	{
 		Cutscene(
@@ -125,23 +192,27 @@ namespace BlastOff
 			ImageTextureLoader* const imageTextureLoader,
 			TextTextureLoader* const textTextureLoader,
 			Vector2f* const cameraPosition,
-			const Callback& resetCallback
+			OutcomeStatistics* const outcomeStatistics,
+			const Callback& resetCallback,
+			const GamePopulation& population,
+			const uint64_t seed
 		);
 
+		void Reset(const uint64_t seed) override;
 		void Update() override;
 
 	protected:
 		bool ResetTimerIsActive() const;
 		void ChooseOutcome(const Outcome outcome) override;
 
-		static inline uint64_t m_WinCount = 0;
-		static inline uint64_t m_LossCount = 0;
-
 		static const bool c_PrintOutcomeStatistics;		
 		static const float c_MaxResetTick;
 		
 		float m_ResetTick = c_DeactivatedTick;
 
+		// may be null, if nobody is interested in the outcome
+		OutcomeStatistics* m_OutcomeStatistics = nullptr;
+
 		Callback m_ResetCallback;
 	};
 }
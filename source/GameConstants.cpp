@@ -3,7 +3,6 @@
 namespace BlastOff
 {
 	GameConstants::GameConstants() :
-		m_LoadingScreenShown(true),
 		m_AmountOfLowClouds(30),
 		m_AmountOfHighClouds(30),
 		m_CameraYOffset(-2 / 3.0f),
@@ -20,11 +19,6 @@ namespace BlastOff
 #endif
 	}
 
-	bool GameConstants::GetLoadingScreenShown() const
-	{
-		return m_LoadingScreenShown;
-	}
-
 	float GameConstants::GetCameraYOffset() const
 	{
 		return m_CameraYOffset;
@@ -9,8 +9,6 @@ namespace BlastOff
 	{
 		GameConstants();
 
-		bool GetLoadingScreenShown() const;
-
 		float GetCameraYOffset() const;
 		float GetWorldBoundHeight() const;
 		float GetCragWidthMultiplier() const;
@@ -27,8 +25,6 @@ namespace BlastOff
 		int GetEmptyPlayerFuelKey() const;
 #endif
 	private:
-		bool m_LoadingScreenShown;
-
 		float m_CameraYOffset;
 		float m_WorldBoundHeight;
 		float m_CragWidthMultiplier;
@@ -1,12 +1,18 @@
 #include "Graphics.h"
 #include "Logging.h"
 #include "OperatingSystem.h"
+#include "Profiler.h"
 #include "ProgramConstants.h"
+#include "TextureAtlas.h"
 #include "Utils.h"
 
 #include "raylib.h"
 
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
 #include <memory>
+#include <fstream>
 
 namespace BlastOff
 {
@@ -37,19 +43,220 @@ namespace BlastOff
 			else
 				return result;
 		}
+
+		// the image size lives in the IHDR chunk,
+		// which the PNG spec requires to come right after the signature
+		optional<Vector2i> ReadPNGSize(const string& resultingPath)
+		{
+			constexpr size_t headerSize = 24;
+			constexpr size_t widthOffset = 16;
+			constexpr size_t heightOffset = 20;
+
+			const auto readBigEndian =
+				[](const unsigned char* const bytes) -> int
+				{
+					return 
+						(bytes[0] << 24) | 
+						(bytes[1] << 16) | 
+						(bytes[2] << 8) | 
+						bytes[3];
+				};
+
+			std::ifstream reader(resultingPath, std::ios::binary);
+			if (!reader)
+				return std::nullopt;
+
+			array<unsigned char, headerSize> header = { 0 };
+			reader.read((char*)header.data(), headerSize);
+			if (reader.gcount() != (std::streamsize)headerSize)
+				return std::nullopt;
+
+			const char* const bytes = (const char*)header.data();
+			const bool isPNG = 
+			{
+				(string(bytes + 1, 3) == "PNG") && 
+				(string(bytes + 12, 4) == "IHDR")
+			};
+			if (!isPNG)
+				return std::nullopt;
+
+			return Vector2i
+			{
+				readBigEndian(header.data() + widthOffset),
+				readBigEndian(header.data() + heightOffset)
+			};
+		}
+
+		Texture LoadHeadlessPNG(const char* const resourcePath)
+		{
+			const static string start = string("resource/png/");
+			const string resultingPath = start + resourcePath;
+
+			const optional<Vector2i> size = ReadPNGSize(resultingPath);
+			if (!size)
+			{
+				OnPNGLoadingError(resultingPath);
+				return Texture{ 0 };
+			}
+
+			// id 0 is never a valid GPU texture,
+			// so nothing will ever try to unload this
+			return Texture
+			{
+				.id = 0,
+				.width = size->x,
+				.height = size->y,
+				.mipmaps = 1,
+				.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8
+			};
+		}
+
+		// both images have to be uncompressed RGBA
+		void CopyPixels(
+			Image* const destination, 
+			const Image& source, 
+			const Vector2i position
+		)
+		{
+			constexpr int pixelSize = 4;
+			unsigned char* const destinationData = 
+			{
+				(unsigned char*)destination->data
+			};
+			const unsigned char* const sourceData = 
+			{
+				(const unsigned char*)source.data
+			};
+
+			const size_t rowSize = (size_t)source.width * pixelSize;
+			for (int row = 0; row < source.height; row++)
+			{
+				const size_t destinationIndex = 
+				{
+					((size_t)(position.y + row) * destination->width) + 
+					position.x
+				};
+				const size_t sourceIndex = (size_t)row * source.width;
+				std::memcpy(
+					destinationData + (destinationIndex * pixelSize),
+					sourceData + (sourceIndex * pixelSize),
+					rowSize
+				);
+			}
+		}
+
+		// repeats the outermost pixels of a cell out into its padding
+		void ExtrudeEdges(
+			Image* const atlas, 
+			const Vector2i position, 
+			const Vector2i size, 
+			const int padding
+		)
+		{
+			constexpr int pixelSize = 4;
+			unsigned char* const data = (unsigned char*)atlas->data;
+
+			const auto getPixel =
+				[&](const int x, const int y) -> unsigned char*
+				{
+					const size_t index = ((size_t)y * atlas->width) + x;
+					return data + (index * pixelSize);
+				};
+
+			const int left = position.x;
+			const int right = position.x + size.x - 1;
+			const int top = position.y;
+			const int bottom = position.y + size.y - 1;
+			const size_t rowSize = (size_t)size.x * pixelSize;
+
+			for (int offset = 1; offset <= padding; offset++)
+			{
+				std::memcpy(
+					getPixel(left, top - offset), 
+					getPixel(left, top), 
+					rowSize
+				);
+				std::memcpy(
+					getPixel(left, bottom + offset), 
+					getPixel(left, bottom), 
+					rowSize
+				);
+			}
+
+			for (int y = top - padding; y <= bottom + padding; y++)
+			{
+				for (int offset = 1; offset <= padding; offset++)
+				{
+					std::memcpy(
+						getPixel(left - offset, y), 
+						getPixel(left, y), 
+						pixelSize
+					);
+					std::memcpy(
+						getPixel(right + offset, y), 
+						getPixel(right, y), 
+						pixelSize
+					);
+				}
+			}
+		}
+
+		// same result as MeasureTextEx(),
+		// which refuses to measure a font that has no GPU texture
+		Vector2f MeasureHeadlessText(
+			const Font& font,
+			const char* const text,
+			const float fontSize,
+			const float spacing
+		)
+		{
+			const float scale = fontSize / (float)font.baseSize;
+
+			float width = 0;
+			int glyphCount = 0;
+			for (const char* next = text; *next;)
+			{
+				int codepointSize = 0;
+				const int codepoint = GetCodepointNext(next, &codepointSize);
+				const int index = GetGlyphIndex(font, codepoint);
+				const GlyphInfo& glyph = font.glyphs[index];
+
+				if (glyph.advanceX)
+					width += glyph.advanceX;
+				else
+					width += glyph.image.width + glyph.offsetX;
+
+				glyphCount++;
+				next += codepointSize;
+			}
+
+			if (!glyphCount)
+				return Vector2f::Zero();
+
+			const float scaledWidth = 
+			{
+				(width * scale) + (spacing * (glyphCount - 1))
+			};
+			return { scaledWidth, fontSize };
+		}
 	}
 
 	RayWindow::RayWindow(
 		const Vector2i size,
-		const string& title
-	) : m_Size(size)
+		const string& title,
+		const bool isHeadless
+	) : 
+		m_IsHeadless(isHeadless),
+		m_Size(size)
 	{
-		InitWindow(size.x, size.y, title.c_str());
+		if (!m_IsHeadless)
+			InitWindow(size.x, size.y, title.c_str());
 	}
 
 	RayWindow::~RayWindow()
 	{
-		CloseWindow();
+		if (!m_IsHeadless)
+			CloseWindow();
 	}
 
 	void RayWindow::Update()
@@ -60,6 +267,9 @@ namespace BlastOff
 				m_Size = Vector2i{ GetRenderWidth(), GetRenderHeight() };
 			};
 
+		if (m_IsHeadless)
+			return;
+
 		UpdatePosition();
 		updateSize();
 	}
@@ -76,12 +286,18 @@ namespace BlastOff
 
 	void RayWindow::SetPosition(const Vector2i position)
 	{
-		SetWindowPosition(position.x, position.y);
+		if (m_IsHeadless)
+			m_Position = position;
+		else
+			SetWindowPosition(position.x, position.y);
 	}
 
 	void RayWindow::SetSize(const Vector2i size)
 	{
-		SetWindowSize(size.x, size.y);
+		if (m_IsHeadless)
+			m_Size = size;
+		else
+			SetWindowSize(size.x, size.y);
 	}
 
 	void RayWindow::UpdatePosition()
@@ -189,6 +405,15 @@ namespace BlastOff
 		return m_MostRecentWindowSize / m_PixelsPerUnit;
 	}
 
+	Rect2f CoordinateTransformer::CalculateVisibleRect() const
+	{
+		// whatever ToScreenCoordinates() puts at the window's center
+		const Vector2f camPos = *m_CameraPosition;
+		const Vector2f center = { -camPos.x, camPos.y };
+
+		return Rect2f(center, GetViewportSize());
+	}
+
 	void CoordinateTransformer::Update()
 	{
 		const auto recomputePixelsPerUnit =
@@ -225,6 +450,48 @@ namespace BlastOff
 
 	}
 
+	Sprite::Sprite(const Sprite& other) :
+		m_LocalRotation(other.m_LocalRotation),
+		m_Opacity(other.m_Opacity),
+		m_Scale(other.m_Scale),
+		m_EngineRect(other.m_EngineRect),
+		m_CollisionRect(other.m_CollisionRect),
+		m_CoordTransformer(other.m_CoordTransformer),
+		m_ProgramConstants(other.m_ProgramConstants)
+	{
+		SetParent(other.m_Parent);
+	}
+
+	Sprite::~Sprite()
+	{
+		// anything still parented to this sprite becomes an orphan,
+		// instead of holding onto a dangling pointer
+		for (Sprite* const child : m_Children)
+		{
+			child->m_Parent = nullptr;
+			child->InvalidateTransform();
+		}
+		SetParent(nullptr);
+	}
+
+	Sprite& Sprite::operator=(const Sprite& other)
+	{
+		if (this == &other)
+			return *this;
+
+		m_LocalRotation = other.m_LocalRotation;
+		m_Opacity = other.m_Opacity;
+		m_Scale = other.m_Scale;
+		m_EngineRect = other.m_EngineRect;
+		m_CollisionRect = other.m_CollisionRect;
+		m_CoordTransformer = other.m_CoordTransformer;
+		m_ProgramConstants = other.m_ProgramConstants;
+
+		SetParent(other.m_Parent);
+		InvalidateTransform();
+		return *this;
+	}
+
 	float Sprite::GetEdgePosition(const Direction side) const
 	{
 		const optional<float> result = m_EngineRect.GetEdgePosition(side);
@@ -243,6 +510,29 @@ namespace BlastOff
 	}
 
 	Vector2f Sprite::CalculateRealPosition() const
+	{
+		if (m_IsTransformDirty)
+			UpdateCachedTransform();
+
+		return m_CachedRealPosition;
+	}
+
+	Vector2f Sprite::CalculateRealSize() const
+	{
+		const Vector2f engineSize = m_EngineRect.GetSize();
+		const Vector2f result = engineSize * m_Scale;
+		return result;
+	}
+
+	float Sprite::CalculateRealRotation() const
+	{
+		if (m_IsTransformDirty)
+			UpdateCachedTransform();
+
+		return m_CachedRealRotation;
+	}
+
+	void Sprite::UpdateCachedTransform() const
 	{
 		const auto calculateParentalOffset =
 			[this]()
@@ -278,22 +568,6 @@ namespace BlastOff
 				}
 			};
 
-		const Vector2f parentalOffset = calculateParentalOffset();
-		const Vector2f rotatedLocalPosition = calculateRotatedLocalPosition();
-
-		const Vector2f result = parentalOffset + rotatedLocalPosition;
-		return result;
-	}
-
-	Vector2f Sprite::CalculateRealSize() const
-	{
-		const Vector2f engineSize = m_EngineRect.GetSize();
-		const Vector2f result = engineSize * m_Scale;
-		return result;
-	}
-
-	float Sprite::CalculateRealRotation() const
-	{
 		const auto calculateParentalRotation =
 			[this]() -> float
 			{
@@ -303,7 +577,22 @@ namespace BlastOff
 					return 0;
 			};
 
-		return m_LocalRotation + calculateParentalRotation();
+		const Vector2f parentalOffset = calculateParentalOffset();
+		const Vector2f rotatedLocalPosition = calculateRotatedLocalPosition();
+
+		m_CachedRealPosition = parentalOffset + rotatedLocalPosition;
+		m_CachedRealRotation = m_LocalRotation + calculateParentalRotation();
+		m_IsTransformDirty = false;
+	}
+
+	void Sprite::InvalidateTransform() const
+	{
+		if (m_IsTransformDirty)
+			return;
+
+		m_IsTransformDirty = true;
+		for (const Sprite* const child : m_Children)
+			child->InvalidateTransform();
 	}
 
 	Rect2f Sprite::CalculateRealRect() const
@@ -373,13 +662,23 @@ namespace BlastOff
 
 	void Sprite::SetEngineRect(const Rect2f engineRect)
 	{
+		// the camera empty sets its rect every frame,
+		// whether or not the camera has moved
+		if (engineRect == m_EngineRect)
+			return;
+
 		m_EngineRect = engineRect;
+		InvalidateTransform();
 	}
 
 	void Sprite::SetEngineSize(const Vector2f engineSize)
 	{
 		const Vector2f enginePosition = m_EngineRect.GetPosition();
 		m_EngineRect = Rect2f(enginePosition, engineSize);
+
+		// an image's crop offset, which its children inherit,
+		// depends on its size
+		InvalidateTransform();
 	}
 
 	void Sprite::SetOpacity(const float opacity)
@@ -401,7 +700,27 @@ namespace BlastOff
 			BreakProgram();
 		}
 #endif
+		const auto removeFromParent =
+			[this]()
+			{
+				vector<Sprite*>& siblings = m_Parent->m_Children;
+				const auto iterator = std::find(
+					siblings.begin(), 
+					siblings.end(), 
+					this
+				);
+				if (iterator != siblings.end())
+					siblings.erase(iterator);
+			};
+
+		if (m_Parent)
+			removeFromParent();
+
 		m_Parent = parent;
+		if (m_Parent)
+			m_Parent->m_Children.push_back(this);
+
+		InvalidateTransform();
 	}
 
 	void Sprite::SetScale(const float scale)
@@ -418,11 +737,13 @@ namespace BlastOff
 	{
 		const Vector2f size = m_EngineRect.GetSize();
 		m_EngineRect = Rect2f(translation, size);
+		InvalidateTransform();
 	}
 
 	void Sprite::SetLocalRotation(const float rotation)
 	{
 		m_LocalRotation = rotation;
+		InvalidateTransform();
 	}
 
 	bool Sprite::IsOrphan() const
@@ -436,14 +757,27 @@ namespace BlastOff
 		return collisionRect.CollideWithLine(line);
 	}
 
+	bool Sprite::IsVisible(const Rect2f visibleRect) const
+	{
+		Rect2f realRect = CalculateRealRect();
+		if (CalculateRealRotation() != 0)
+		{
+			const float diagonal = realRect.GetSize().Magnitude();
+			realRect = Rect2f(realRect.GetPosition(), { diagonal, diagonal });
+		}
+		return realRect.CollideWithRect(visibleRect);
+	}
+
 	void Sprite::Move(const Vector2f translation)
 	{
 		m_EngineRect = m_EngineRect.Translate(translation);
+		InvalidateTransform();
 	}
 
 	void Sprite::Rotate(const float rotation)
 	{
 		m_LocalRotation += rotation;
+		InvalidateTransform();
 	}
 
 	void Sprite::Update()
@@ -451,6 +785,11 @@ namespace BlastOff
 		// nothing to do here.
 	}
 
+	void Sprite::Draw(RenderQueue* const renderQueue) const
+	{
+		renderQueue->Submit(this);
+	}
+
 	
 	Empty::Empty(
 		const Vector2f enginePosition,
@@ -466,9 +805,15 @@ namespace BlastOff
 
 	}
 
-	void Empty::Draw() const
+	void Empty::Draw(RenderQueue* const renderQueue) const
 	{
 		// nothing to do here.
+		(void)renderQueue;
+	}
+
+	void Empty::DrawImmediately() const
+	{
+		// nothing to do here either.
 	}
 
 	Rect2f Empty::SetEnginePosition(const Vector2f enginePosition)
@@ -515,7 +860,7 @@ namespace BlastOff
 		
 	}
 
-	void GradientSprite::Draw() const
+	void GradientSprite::DrawImmediately() const
 	{
 		struct CornerColours
 		{
@@ -578,13 +923,60 @@ namespace BlastOff
 			};
 
 		const Rect2f realRect = CalculateRealRect();
+
+		// only the visible band gets drawn, 
+		// with its colours taken from where it sits in the full gradient
+		const auto clipCornerColours =
+			[&](const Rect2f clippedRect) -> CornerColours
+			{
+				const CornerColours full = calculateCornerColours();
+				const float realLeft = realRect.x - (realRect.w / 2.0f);
+				const float realTop = realRect.y + (realRect.h / 2.0f);
+
+				const auto sample =
+					[&](const float x, const float y) -> Colour4i
+					{
+						const float u = (x - realLeft) / realRect.w;
+						const float v = (realTop - y) / realRect.h;
+
+						const Colour4i top = 
+						{
+							Lerp(full.topLeft, full.topRight, u)
+						};
+						const Colour4i bottom = 
+						{
+							Lerp(full.bottomLeft, full.bottomRight, u)
+						};
+						return Lerp(top, bottom, v);
+					};
+
+				const float left = clippedRect.x - (clippedRect.w / 2.0f);
+				const float right = clippedRect.x + (clippedRect.w / 2.0f);
+				const float top = clippedRect.y + (clippedRect.h / 2.0f);
+				const float bottom = clippedRect.y - (clippedRect.h / 2.0f);
+
+				const CornerColours result =
+				{
+					sample(left, top),
+					sample(right, top),
+					sample(left, bottom),
+					sample(right, bottom)
+				};
+				return result;
+			};
+
+		const Rect2f visibleRect = m_CoordTransformer->CalculateVisibleRect();
+		const optional<Rect2f> clippedRect = realRect.Intersect(visibleRect);
+		if (!clippedRect)
+			return;
+
 		const Rect2f drawRect = 
 		{
-			m_CoordTransformer->ToScreenCoordinates(realRect)
+			m_CoordTransformer->ToScreenCoordinates(*clippedRect)
 		};
 		const RayRect2f convertedDrawRect = drawRect.ToRayRect2f();
 
-		const CornerColours cornerColours = calculateCornerColours();
+		const CornerColours cornerColours = clipCornerColours(*clippedRect);
 
 #if !COMPILE_CONFIG_TESTING
 		DrawRectangleGradientEx(
@@ -605,190 +997,707 @@ namespace BlastOff
 		TEXTURE_FILTER_TRILINEAR
 	};
 
-	ImageTextureLoader::~ImageTextureLoader()
+	void DecodedImage::Unload() const
 	{
-		for (const auto& [name, texture] : m_CachedValues)
-		{
-			(void)name;
-			UnloadTexture(texture);
-		}
+		if (!isMapped)
+			UnloadImage(image);
 	}
 
-	const Texture* ImageTextureLoader::LazyLoadTexture
-		(const char* const resourcePath)
+
+	ImageTextureLoader::ImageTextureLoader(
+		AssetManager* const assetManager,
+		const bool isHeadless
+	) :
+		m_IsHeadless(isHeadless),
+		m_AssetManager(assetManager)
 	{
-		const auto getCachedValue =
-			[&, this]() -> const Texture*
-			{
-				try
-				{
-					return &m_CachedValues.at(resourcePath);
-				}
-				catch (const std::out_of_range& exception)
-				{
-					(void)exception;
-					return nullptr;
-				}
-			};
 
-		const auto result = getCachedValue();
-		if (!result)
-			return LoadAndInsert(resourcePath);
-		else
-			return result;
 	}
 
-	const Texture* ImageTextureLoader::LoadAndInsert
-		(const char* const resourcePath)
+	TextureRegion TextureRegion::FromTexture(const Texture* const texture)
 	{
-		const Texture result = LoadPNG(resourcePath);
-		m_CachedValues.insert({ resourcePath, result });
+		TextureRegion result = {};
+		if (!texture)
+			return result;
 
-		SetTextureFilter(result, c_DefaultTextureFiltering);
-		return &m_CachedValues.at(resourcePath);
+		result.texture = texture;
+		result.width = texture->width;
+		result.height = texture->height;
+		return result;
 	}
 
-
-	bool TextTextureParameters::operator==
-		(const TextTextureParameters& other) const
+	Vector2i TextureRegion::GetSize() const
 	{
-		return
-			(fontSize == other.fontSize) &&
-			(spacing == other.spacing) &&
-			(colour == other.colour) &&
-			(message == other.message);
+		return { width, height };
 	}
 
-	size_t TextTextureParameters::Hasher::operator()
-		(const TextTextureParameters& key) const
-	{
-		const int* colourInt = (int*)(&key.colour);
-		using std::hash;
-
-		constexpr size_t start = 17;
-		constexpr size_t multiplier = 31;
 
-		size_t result = start;
-		result = (result * multiplier) + hash<float>()(key.fontSize);
-		result = (result * multiplier) + hash<float>()(key.spacing);
-		result = (result * multiplier) + hash<int>()(*colourInt);
-		result = (result * multiplier) + hash<string>()(key.message);
-		return result;
+	ImageTextureLoader::~ImageTextureLoader()
+	{
+		for (const auto& [name, texture] : m_Textures)
+		{
+			(void)name;
+			if (texture.id)
+				UnloadTexture(texture);
+		}
 	}
 
-
-	TextTextureLoader::TextTextureLoader(const Font* const font) :
-		m_Font(font)
+	void ImageTextureLoader::BuildAtlases()
 	{
+		PROFILE_ZONE("ImageTextureLoader::BuildAtlases");
 
-	}
+		if (m_IsHeadless)
+			return;
 
-	TextTextureLoader::~TextTextureLoader()
-	{
-		for (const auto& [key, texture] : m_CachedValues)
+		vector<DecodedImage> images = {};
+		for (const string& path : FindAtlasPaths())
 		{
-			(void)key;
-			UnloadTexture(texture);
+			optional<DecodedImage> decoded = DecodePNG(path);
+			if (!decoded)
+			{
+				OnPNGLoadingError(c_ResourceDirectory + path);
+				continue;
+			}
+			images.push_back(*decoded);
 		}
+		BuildAtlases(images);
 	}
 
-	const Texture* TextTextureLoader::LazyLoadTexture
-		(const Parameters& parameters)
+	void ImageTextureLoader::BuildAtlases(const vector<DecodedImage>& images)
 	{
-		const auto getCachedValue =
-			[&, this]() -> const Texture*
+		PROFILE_ZONE("ImageTextureLoader::BuildAtlases from decoded");
+
+		const auto calculatePaddedSizes =
+			[&]() -> vector<Vector2i>
 			{
-				try
-				{
-					return &m_CachedValues.at(parameters);
-				}
-				catch (const std::out_of_range& exception)
+				const int padding = c_AtlasPadding * 2;
+
+				vector<Vector2i> result = {};
+				result.reserve(images.size());
+				for (const DecodedImage& decoded : images)
 				{
-					(void)exception;
-					return nullptr;
+					const Image& image = decoded.image;
+					result.push_back({ 
+						image.width + padding, 
+						image.height + padding 
+					});
 				}
+				return result;
 			};
 
-		const auto result = getCachedValue();
-		if (!result)
-			return LoadAndInsert(parameters);
-		else
-			return result;
-	}
-
-	Vector2f TextTextureLoader::Measure(const Parameters& parameters) const
-	{
-		const RayVector2f rayResult = MeasureTextEx(
-			*m_Font,
-			parameters.message.c_str(),
-			parameters.fontSize,
-			parameters.spacing
-		);
-		return Vector2f::FromRayVector2f(rayResult);
-	}
+		const auto uploadAtlas =
+			[this](Image* const atlasImage, const size_t atlasIndex)
+				-> const Texture*
+			{
+				const string name = "atlas:" + std::to_string(atlasIndex);
+				const Texture texture = LoadTextureFromImage(*atlasImage);
+				SetTextureFilter(texture, c_DefaultTextureFiltering);
+				UnloadImage(*atlasImage);
 
-	const Texture* TextTextureLoader::LoadAndInsert
-		(const Parameters& parameters)
-	{
-		const char* cString = parameters.message.c_str();
-		CheckMessage(cString);
-		
-		const Image image = ImageTextEx(
-			*m_Font,
-			cString,
-			parameters.fontSize,
-			parameters.spacing,
-			parameters.colour.ToRayColour()
-		);
-		const Texture result = LoadTextureFromImage(image);
-		m_CachedValues.insert({ parameters, result });
+				m_Textures.insert({ name, texture });
+				return &m_Textures.at(name);
+			};
 
-		SetTextureFilter(
-			result, 
-			ImageTextureLoader::c_DefaultTextureFiltering
-		);
-		return &m_CachedValues.at(parameters);
-	}
+		if (m_IsHeadless)
+		{
+			for (const DecodedImage& decoded : images)
+				decoded.Unload();
+			return;
+		}
 
-	void TextTextureLoader::CheckMessage(const char* const message)
-	{
-		const bool containsNewline = 
+		AtlasPacker packer(c_AtlasSize);
+		const vector<optional<AtlasPlacement>> placements =
 		{
-			StringContains(message, '\n')
+			packer.Pack(calculatePaddedSizes())
 		};
-		if (containsNewline)
+		const vector<Vector2i>& extents = packer.GetAtlasExtents();
+
+		// blank, so anything between cells is transparent
+		vector<Image> atlasImages = {};
+		atlasImages.reserve(extents.size());
+		for (const Vector2i extent : extents)
+			atlasImages.push_back(GenImageColor(extent.x, extent.y, BLANK));
+
+		for (size_t index = 0; index < images.size(); index++)
 		{
-			const char* const message = 
+			const optional<AtlasPlacement>& placement = placements.at(index);
+			if (!placement)
+				continue;
+
+			const Image& image = images.at(index).image;
+			const Vector2i position = 
 			{
-				"TextSprites should not contain "
-				"newline characters in their message. "
-				"Please use multiple TextSprites instead."
+				placement->position.x + c_AtlasPadding,
+				placement->position.y + c_AtlasPadding
 			};
-			Logging::LogWarning(message);
+			const Vector2i size = { image.width, image.height };
+
+			Image* const atlasImage = &atlasImages.at(placement->atlasIndex);
+			CopyPixels(atlasImage, image, position);
+			ExtrudeEdges(atlasImage, position, size, c_AtlasPadding);
 		}
-	}
 
+		vector<const Texture*> atlases = {};
+		for (size_t index = 0; index < atlasImages.size(); index++)
+			atlases.push_back(uploadAtlas(&atlasImages.at(index), index));
 
-	ImageSprite::ImageSprite(
-		const Rect2f engineRect,
-		const CoordinateTransformer* const coordTransformer,
-		const ProgramConstants* const programConstants,
-		const Texture* const texture
-	) :
-		Sprite(
-			engineRect, 
-			coordTransformer, 
-			programConstants
-		)
-	{
-		SetTexture(texture);
-	}
+		size_t packedCount = 0;
+		for (size_t index = 0; index < images.size(); index++)
+		{
+			const DecodedImage& decoded = images.at(index);
+			const optional<AtlasPlacement>& placement = placements.at(index);
 
-	ImageSprite::ImageSprite(
-		const CoordinateTransformer* const coordTransformer,
-		const ProgramConstants* const programConstants,
-		const Texture* const texture
-	) :
+			// too big for an atlas, so it gets its own texture
+			if (!placement)
+			{
+				InsertDecodedImage(decoded);
+				continue;
+			}
+
+			const ImageHandle handle = Resolve(decoded.path);
+			TextureRegion* const region = GetRegion(handle);
+			region->texture = atlases.at(placement->atlasIndex);
+			region->x = placement->position.x + c_AtlasPadding;
+			region->y = placement->position.y + c_AtlasPadding;
+			region->width = decoded.image.width;
+			region->height = decoded.image.height;
+
+			// only its own pixels, not the padding around them
+			const size_t byteSize =
+			{
+				(size_t)region->width * (size_t)region->height * 4
+			};
+			m_AssetManager->MarkLoaded(handle, byteSize, decoded.loadTime);
+			decoded.Unload();
+			packedCount++;
+		}
+
+		const string message = std::format(
+			"Packed {} images into {} texture atlases.",
+			packedCount,
+			atlases.size()
+		);
+		Logging::Log(message.c_str());
+	}
+
+	vector<string> ImageTextureLoader::FindAtlasPaths() const
+	{
+		const auto findLoosePaths =
+			[]() -> vector<string>
+			{
+				namespace fs = std::filesystem;
+
+				vector<string> result = {};
+				std::error_code error;
+				const fs::path directory = c_ResourceDirectory;
+				for (const fs::directory_entry& entry : 
+					fs::recursive_directory_iterator(directory, error))
+				{
+					if (entry.path().extension() != ".png")
+						continue;
+
+					const fs::path relative = 
+					{
+						fs::relative(entry.path(), directory)
+					};
+					result.push_back(relative.generic_string());
+				}
+				return result;
+			};
+
+		// a cooked archive has every image, loose or not
+		const AssetArchive* const archive = m_AssetManager->GetArchive();
+		const vector<string> paths = 
+		{
+			archive ? 
+				archive->FindPaths(c_ArchiveDirectory) : 
+				findLoosePaths()
+		};
+
+		// anything already loaded keeps its own texture
+		vector<string> result = {};
+		for (const string& path : paths)
+		{
+			if (!m_AssetManager->IsLoaded<AssetType::Image>(path))
+				result.push_back(path);
+		}
+
+		// so the same files always pack the same way
+		std::sort(result.begin(), result.end());
+		return result;
+	}
+
+	optional<DecodedImage> ImageTextureLoader::DecodePNG
+		(const string& resourcePath) const
+	{
+		const AssetLoadTimer timer;
+
+		// already decoded, so there's nothing to do but point at it
+		const optional<Image> archived = FindArchivedImage(resourcePath);
+		if (archived)
+		{
+			DecodedImage result = {};
+			result.path = resourcePath;
+			result.image = *archived;
+			result.isMapped = true;
+			result.loadTime = timer.CalculateElapsed();
+			return result;
+		}
+
+		const string resultingPath = c_ResourceDirectory + resourcePath;
+		Image image = LoadImage(resultingPath.c_str());
+		if (!image.data)
+			return std::nullopt;
+
+		ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+		DecodedImage result = {};
+		result.path = resourcePath;
+		result.image = image;
+		result.loadTime = timer.CalculateElapsed();
+		return result;
+	}
+
+	const TextureRegion* ImageTextureLoader::InsertDecodedImage
+		(const DecodedImage& decoded)
+	{
+		PROFILE_ZONE("ImageTextureLoader::InsertDecodedImage");
+
+		const ImageHandle handle = Resolve(decoded.path);
+		if (m_IsHeadless || m_AssetManager->GetRecord(handle).isLoaded)
+		{
+			decoded.Unload();
+			return GetRegion(handle);
+		}
+
+		// the decode happened elsewhere, so only the upload is timed here
+		const AssetLoadTimer timer;
+		const Texture texture = LoadTextureFromImage(decoded.image);
+		SetTextureFilter(texture, c_DefaultTextureFiltering);
+		decoded.Unload();
+
+		m_Textures.insert({ decoded.path, texture });
+		TextureRegion* const region = GetRegion(handle);
+		*region = TextureRegion::FromTexture(&m_Textures.at(decoded.path));
+
+		const size_t byteSize =
+		{
+			(size_t)texture.width * (size_t)texture.height * 4
+		};
+		const uint64_t loadTime = decoded.loadTime + timer.CalculateElapsed();
+		m_AssetManager->MarkLoaded(handle, byteSize, loadTime);
+		return region;
+	}
+
+	ImageHandle ImageTextureLoader::Resolve(const string_view resourcePath)
+	{
+		return m_AssetManager->Resolve<AssetType::Image>(resourcePath);
+	}
+
+	const TextureRegion* ImageTextureLoader::LazyLoadTexture
+		(const ImageHandle handle)
+	{
+		if (!handle.IsValid())
+		{
+			Logging::LogWarning(
+				"ImageTextureLoader::LazyLoadTexture() failed: "
+				"The handle is invalid."
+			);
+			return nullptr;
+		}
+
+		m_AssetManager->AddReference(handle);
+		if (m_AssetManager->GetRecord(handle).isLoaded)
+			return GetRegion(handle);
+
+		m_AssetManager->OnLazyLoad(handle);
+		return LoadAndInsert(handle);
+	}
+
+	const TextureRegion* ImageTextureLoader::LazyLoadTexture
+		(const char* const resourcePath)
+	{
+		return LazyLoadTexture(Resolve(resourcePath));
+	}
+
+	TextureRegion* ImageTextureLoader::GetRegion(const ImageHandle handle)
+	{
+		if (handle.index >= m_Regions.size())
+			m_Regions.resize(handle.index + 1);
+
+		return &m_Regions[handle.index];
+	}
+
+	const TextureRegion* ImageTextureLoader::LoadAndInsert
+		(const ImageHandle handle)
+	{
+		PROFILE_ZONE("ImageTextureLoader::LoadAndInsert");
+
+		const AssetLoadTimer timer;
+		const string& resourcePath = m_AssetManager->GetRecord(handle).path;
+
+		const auto insert =
+			[&, this](const Texture texture) -> const TextureRegion*
+			{
+				m_Textures.insert({ resourcePath, texture });
+
+				const Texture* const inserted = &m_Textures.at(resourcePath);
+				TextureRegion* const region = GetRegion(handle);
+				*region = TextureRegion::FromTexture(inserted);
+
+				// headless textures take up nothing,
+				// but counting them keeps the report the same
+				const size_t byteSize =
+				{
+					(size_t)texture.width * (size_t)texture.height * 4
+				};
+				m_AssetManager->MarkLoaded(
+					handle, 
+					byteSize, 
+					timer.CalculateElapsed()
+				);
+				return region;
+			};
+
+		const optional<Image> archived = FindArchivedImage(resourcePath);
+		if (m_IsHeadless)
+		{
+			if (!archived)
+				return insert(LoadHeadlessPNG(resourcePath.c_str()));
+
+			// id 0, like any other headless texture
+			return insert(Texture
+			{
+				.id = 0,
+				.width = archived->width,
+				.height = archived->height,
+				.mipmaps = 1,
+				.format = archived->format
+			});
+		}
+
+		const Texture result =
+		{
+			archived ?
+				LoadTextureFromImage(*archived) :
+				LoadPNG(resourcePath.c_str())
+		};
+		SetTextureFilter(result, c_DefaultTextureFiltering);
+		return insert(result);
+	}
+
+	optional<Image> ImageTextureLoader::FindArchivedImage
+		(const string_view resourcePath) const
+	{
+		const AssetArchive* const archive = m_AssetManager->GetArchive();
+		if (!archive)
+			return std::nullopt;
+
+		const string archivePath = 
+		{
+			c_ArchiveDirectory + string(resourcePath)
+		};
+		const optional<ArchivedAsset> asset = archive->Find(archivePath);
+		if (!asset || (asset->entry->type != ArchiveEntryType::RawImage))
+			return std::nullopt;
+
+		// a truncated entry would have raylib read past the mapping
+		const ArchiveEntry& entry = *asset->entry;
+		constexpr uint64_t bytesPerPixel = 4;
+		const uint64_t expectedSize =
+		{
+			(uint64_t)entry.width * entry.height * bytesPerPixel
+		};
+		if (entry.dataSize < expectedSize)
+		{
+			const string message =
+			{
+				"ImageTextureLoader::FindArchivedImage() failed: "
+				"\"" + archivePath + "\" is smaller than its size says. "
+				"Loading the loose file instead."
+			};
+			Logging::LogWarning(message.c_str());
+			return std::nullopt;
+		}
+
+		// raylib only ever reads from it, so the archive can stay read-only
+		Image result = {};
+		result.data = (void*)asset->data;
+		result.width = (int)entry.width;
+		result.height = (int)entry.height;
+		result.mipmaps = 1;
+		result.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+		return result;
+	}
+
+	const char* const ImageTextureLoader::c_ResourceDirectory = 
+	{
+		"resource/png/"
+	};
+	const char* const ImageTextureLoader::c_ArchiveDirectory = "png/";
+	const int ImageTextureLoader::c_AtlasSize = 4096;
+	const int ImageTextureLoader::c_AtlasPadding = 2;
+
+
+	TextTextureLoader::TextTextureLoader(
+		const Font* const font, 
+		const bool isHeadless
+	) :
+		m_Font(font),
+		m_IsHeadless(isHeadless)
+	{
+
+	}
+
+	Font TextTextureLoader::LoadHeadlessFont(
+		const char* const path, 
+		const int size
+	)
+	{
+		int fileSize = 0;
+		unsigned char* const fileData = LoadFileData(path, &fileSize);
+		if (!fileData)
+			return Font{ 0 };
+
+		// the same glyph set that LoadFontEx() loads by default
+		constexpr int defaultGlyphCount = 95;
+		constexpr int codepointCount = 0;
+
+		Font result = { 0 };
+		result.baseSize = size;
+		result.glyphCount = defaultGlyphCount;
+		result.glyphs = LoadFontData(
+			fileData, 
+			fileSize, 
+			size, 
+			nullptr, 
+			codepointCount, 
+			FONT_DEFAULT
+		);
+
+		UnloadFileData(fileData);
+		return result;
+	}
+
+	void TextTextureLoader::UnloadHeadlessFont(const Font& font)
+	{
+		if (font.glyphs)
+			UnloadFontData(font.glyphs, font.glyphCount);
+	}
+
+	optional<DecodedFont> TextTextureLoader::DecodeFont(
+		const byte* const data, 
+		const size_t byteSize,
+		const int size
+	)
+	{
+		PROFILE_ZONE("TextTextureLoader::DecodeFont");
+
+		// the same glyph set and padding that LoadFontEx() uses by default
+		constexpr int defaultGlyphCount = 95;
+		constexpr int defaultGlyphPadding = 4;
+		constexpr int codepointCount = 0;
+		constexpr int packMethod = 0;
+
+		DecodedFont result = {};
+		Font& font = result.font;
+		font.baseSize = size;
+		font.glyphCount = defaultGlyphCount;
+		font.glyphs = LoadFontData(
+			data, 
+			(int)byteSize, 
+			size, 
+			nullptr, 
+			codepointCount, 
+			FONT_DEFAULT
+		);
+		if (!font.glyphs)
+			return std::nullopt;
+
+		font.glyphPadding = defaultGlyphPadding;
+		result.atlas = GenImageFontAtlas(
+			font.glyphs, 
+			&font.recs, 
+			font.glyphCount, 
+			size, 
+			font.glyphPadding, 
+			packMethod
+		);
+
+		// raylib cuts each glyph's image back out of the atlas,
+		// so UnloadFont() frees the same things either way
+		for (int index = 0; index < font.glyphCount; index++)
+		{
+			GlyphInfo& glyph = font.glyphs[index];
+			UnloadImage(glyph.image);
+			glyph.image = ImageFromImage(result.atlas, font.recs[index]);
+		}
+		return result;
+	}
+
+	Font TextTextureLoader::InsertDecodedFont(const DecodedFont& decoded)
+	{
+		PROFILE_ZONE("TextTextureLoader::InsertDecodedFont");
+
+		Font result = decoded.font;
+		result.texture = LoadTextureFromImage(decoded.atlas);
+		UnloadImage(decoded.atlas);
+		return result;
+	}
+
+	Vector2f TextTextureLoader::Measure(const Parameters& parameters) const
+	{
+		if (m_IsHeadless)
+		{
+			return MeasureHeadlessText(
+				*m_Font,
+				parameters.message.c_str(),
+				parameters.fontSize,
+				parameters.spacing
+			);
+		}
+
+		const RayVector2f rayResult = MeasureTextEx(
+			*m_Font,
+			parameters.message.c_str(),
+			parameters.fontSize,
+			parameters.spacing
+		);
+		return Vector2f::FromRayVector2f(rayResult);
+	}
+
+	TextLayout TextTextureLoader::LayOut(
+		const Parameters& parameters,
+		const float lineSpacing
+	) const
+	{
+		const vector<string> lines =
+		{
+			SplitString(parameters.message.c_str(), '\n')
+		};
+		const float lineHeight = parameters.fontSize;
+
+		const auto measureLine =
+			[&, this](const string& line) -> float
+			{
+				Parameters lineParameters = parameters;
+				lineParameters.message = line;
+				return Measure(lineParameters).x;
+			};
+
+		// the same placement as DrawTextEx(), padding and all
+		const auto layOutLine =
+			[&, this](
+				const string& line, 
+				const Vector2f linePosition,
+				TextLayout* const layout
+			)
+			{
+				const float scale = parameters.fontSize / m_Font->baseSize;
+				const float padding = (float)m_Font->glyphPadding;
+
+				float xOffset = 0;
+				for (const char* next = line.c_str(); *next;)
+				{
+					int codepointSize = 0;
+					const int codepoint = GetCodepointNext(next, &codepointSize);
+					const int index = GetGlyphIndex(*m_Font, codepoint);
+					const GlyphInfo& glyph = m_Font->glyphs[index];
+					const RayRect2f& rec = m_Font->recs[index];
+
+					const bool isBlank = 
+					{
+						(codepoint == ' ') || (codepoint == '\t')
+					};
+					if (!isBlank)
+					{
+						GlyphPlacement placement = {};
+						placement.sourceRect = Rect2f(
+							rec.x - padding,
+							rec.y - padding,
+							rec.width + (padding * 2),
+							rec.height + (padding * 2)
+						);
+						placement.layoutRect = Rect2f(
+							linePosition.x + xOffset + 
+								((glyph.offsetX - padding) * scale),
+							linePosition.y + 
+								((glyph.offsetY - padding) * scale),
+							placement.sourceRect.w * scale,
+							placement.sourceRect.h * scale
+						);
+						layout->glyphs.push_back(placement);
+					}
+
+					const float advance =
+					{
+						glyph.advanceX ? (float)glyph.advanceX : rec.width
+					};
+					xOffset += (advance * scale) + parameters.spacing;
+					next += codepointSize;
+				}
+			};
+
+		TextLayout result = {};
+		if (lines.empty())
+			return result;
+
+		vector<float> lineWidths = {};
+		lineWidths.reserve(lines.size());
+		for (const string& line : lines)
+		{
+			lineWidths.push_back(measureLine(line));
+			result.size.x = std::max(result.size.x, lineWidths.back());
+		}
+
+		const float linePitch = lineHeight * lineSpacing;
+		result.size.y = lineHeight + (linePitch * (lines.size() - 1));
+
+		// headless fonts can be measured, but there's nothing to draw
+		if (m_IsHeadless)
+			return result;
+
+		for (size_t index = 0; index < lines.size(); index++)
+		{
+			const Vector2f linePosition =
+			{
+				(result.size.x - lineWidths[index]) / 2.0f,
+				linePitch * index
+			};
+			layOutLine(lines[index], linePosition, &result);
+		}
+		return result;
+	}
+
+	const Texture* TextTextureLoader::GetGlyphAtlas() const
+	{
+		if (m_IsHeadless)
+			return nullptr;
+
+		return &m_Font->texture;
+	}
+
+
+	ImageSprite::ImageSprite(
+		const Rect2f engineRect,
+		const CoordinateTransformer* const coordTransformer,
+		const ProgramConstants* const programConstants,
+		const TextureRegion* const texture
+	) :
+		Sprite(
+			engineRect, 
+			coordTransformer, 
+			programConstants
+		)
+	{
+		SetTexture(texture);
+	}
+
+	ImageSprite::ImageSprite(
+		const CoordinateTransformer* const coordTransformer,
+		const ProgramConstants* const programConstants,
+		const TextureRegion* const texture
+	) :
 		ImageSprite(
 			Rect2f::UnitRect(),
 			coordTransformer,
@@ -824,7 +1733,10 @@ namespace BlastOff
 		ImageTextureLoader* imageTextureLoader
 	)
 	{
-		const Texture* texture = imageTextureLoader->LazyLoadTexture(resourcePath);
+		const TextureRegion* texture = 
+		{
+			imageTextureLoader->LazyLoadTexture(resourcePath)
+		};
 		return std::make_unique<ImageSprite>(
 			engineRect,
 			coordTransformer,
@@ -833,15 +1745,43 @@ namespace BlastOff
 		);
 	}
 
+	void ImageSprite::SetTexture(const TextureRegion* const texture)
+	{
+		if (texture)
+			m_Texture = *texture;
+		else
+			m_Texture = {};
+	}
+
 	void ImageSprite::SetTexture(const Texture* const texture)
 	{
-		m_Texture = texture;
+		m_Texture = TextureRegion::FromTexture(texture);
 	}
 
-	void ImageSprite::Draw() const
+	void ImageSprite::Draw(RenderQueue* const renderQueue) const
 	{
-		const Vector2i textureSize = { m_Texture->width, m_Texture->height };
-		const Rect2f sourceRect = m_Crop.CalculateSourceRect(textureSize);
+		renderQueue->Submit(CalculateQuad());
+	}
+
+	void ImageSprite::DrawImmediately() const
+	{
+		RenderQueue::DrawQuad(CalculateQuad());
+	}
+
+	RenderQuad ImageSprite::CalculateQuad() const
+	{
+		// the crop is relative to the image, which might only be
+		// one cell of an atlas
+		const Vector2f regionPosition = 
+		{ 
+			(float)m_Texture.x, 
+			(float)m_Texture.y 
+		};
+		const Rect2f sourceRect = 
+		{
+			m_Crop.CalculateSourceRect(m_Texture.GetSize())
+				.Translate(regionPosition)
+		};
 
 		const Rect2f realRect = CalculateRealRect();
 		Rect2f drawRect =
@@ -855,16 +1795,14 @@ namespace BlastOff
 		const Vector2f drawOrigin = drawRect.GetSize() / 2.0f;
 		drawRect = drawRect.Translate(drawOrigin);
 
-#if !COMPILE_CONFIG_TESTING
-		DrawTexturePro(
-			*m_Texture,
-			sourceRect.ToRayRect2f(),
-			drawRect.ToRayRect2f(),
-			drawOrigin.ToRayVector2f(),
-			CalculateRealRotation(),
-			drawTint.ToRayColour()
-		);
-#endif
+		RenderQuad result = {};
+		result.texture = m_Texture.texture;
+		result.sourceRect = sourceRect;
+		result.destinationRect = drawRect;
+		result.origin = drawOrigin;
+		result.rotation = CalculateRealRotation();
+		result.tint = drawTint;
+		return result;
 	}
 	
 	Vector2f ImageSprite::CalculateRealPosition() const
@@ -877,7 +1815,7 @@ namespace BlastOff
 	
 	Vector2f ImageSprite::CalculateRealSize() const
 	{
-		const Vector2i textureSize = { m_Texture->width, m_Texture->height };
+		const Vector2i textureSize = m_Texture.GetSize();
 		const Rect2f sourceRect = m_Crop.CalculateSourceRect(textureSize);
 
 		const Vector2f baseResult = Sprite::CalculateRealSize();
@@ -915,8 +1853,8 @@ namespace BlastOff
 	{
 		const Vector2f textureSize = 
 		{ 
-			(float)m_Texture->width, 
-			(float)m_Texture->height 
+			(float)m_Texture.width, 
+			(float)m_Texture.height 
 		};
 		const Vector2f cropRatio = croppedSize / textureSize;
 		return cropRatio;
@@ -924,12 +1862,17 @@ namespace BlastOff
 
 	Vector2i ImageSprite::GetImageSize() const
 	{
-		return Vector2i{ m_Texture->width, m_Texture->height };
+		return m_Texture.GetSize();
 	}
 
 	void ImageSprite::SetCrop(const Crop2f crop)
 	{
+		if (crop == m_Crop)
+			return;
+
+		// children inherit the crop offset through CalculateRealPosition()
 		m_Crop = crop;
+		InvalidateTransform();
 	}
 
 
@@ -942,11 +1885,10 @@ namespace BlastOff
 		TextTextureLoader* const textureLoader,
 		const string& message
 	) :
-		ImageSprite(
+		Sprite(
 			Rect2f(enginePosition, Vector2f::Zero()),
 			coordTransformer,
-			programConstants,
-			nullptr
+			programConstants
 		),
 		m_Colour(colour),
 		m_FontSize(fontSize),
@@ -965,63 +1907,100 @@ namespace BlastOff
 	{
 		m_Message = message;
 
-		m_ShouldRecacheTexture = true;
+		m_ShouldLayOut = true;
+	}
+
+	void TextLineSprite::SetLineSpacing(const float lineSpacing)
+	{
+		m_LineSpacing = lineSpacing;
+
+		m_ShouldLayOut = true;
+	}
+
+	void TextLineSprite::SetCrop(const Crop2f crop)
+	{
+		m_Crop = crop;
 	}
 
 	void TextLineSprite::SetEngineRect(const Rect2f engineRect)
 	{
 		Sprite::SetEngineRect(engineRect);
 
-		m_ShouldRecacheTexture = true;
+		m_ShouldLayOut = true;
 	}
 
 	void TextLineSprite::SetScale(const float scale)
 	{
 		Sprite::SetScale(scale);
 
-		m_ShouldRecacheTexture = true;
+		m_ShouldLayOut = true;
 	}
 
 	void TextLineSprite::SetScale(const Vector2f scale)
 	{
 		Sprite::SetScale(scale);
 
-		m_ShouldRecacheTexture = true;
+		m_ShouldLayOut = true;
 	}
 
 	void TextLineSprite::Update()
 	{
-		const auto recalculateEngineSize =
+		const auto layOut =
 			[this]()
 			{
 				const Parameters parameters = CalculateParameters();
-				const float ppu = m_CoordTransformer->GetFontPixelsPerUnit();
+				m_Layout = m_TextureLoader->LayOut(parameters, m_LineSpacing);
+			};
 
-				const Vector2f measurement = 
-				{
-					m_TextureLoader->Measure(parameters) / ppu
-				};
+		const auto recalculateEngineSize =
+			[this]()
+			{
+				const float ppu = m_CoordTransformer->GetFontPixelsPerUnit();
+				const Vector2f engineSize = m_Layout.size / ppu;
 
 				const Vector2f enginePosition = m_EngineRect.GetPosition();
-				m_EngineRect = Rect2f(enginePosition, measurement);
+				Sprite::SetEngineRect(Rect2f(enginePosition, engineSize));
 			};
 
-		const auto lazyLoadTexture =
-			[this]()
+		if (m_ShouldLayOut)
+		{
+			layOut();
+			recalculateEngineSize();
+			m_ShouldLayOut = false;
+		}
+	}
+
+	void TextLineSprite::Draw(RenderQueue* const renderQueue) const
+	{
+		if (m_Layout.glyphs.empty())
+			return;
+
+		const RenderQuad messageQuad = CalculateQuad();
+		for (const GlyphPlacement& glyph : m_Layout.glyphs)
+		{
+			const optional<RenderQuad> quad =
 			{
-				const Parameters parameters = CalculateParameters();
-				const Texture* const newTexture = 
-				{
-					m_TextureLoader->LazyLoadTexture(parameters)
-				};
-				SetTexture(newTexture);
+				CalculateGlyphQuad(messageQuad, glyph)
 			};
+			if (quad)
+				renderQueue->Submit(*quad);
+		}
+	}
 
-		if (m_ShouldRecacheTexture)
+	void TextLineSprite::DrawImmediately() const
+	{
+		if (m_Layout.glyphs.empty())
+			return;
+
+		const RenderQuad messageQuad = CalculateQuad();
+		for (const GlyphPlacement& glyph : m_Layout.glyphs)
 		{
-			recalculateEngineSize();
-			lazyLoadTexture();
-			m_ShouldRecacheTexture = false;
+			const optional<RenderQuad> quad =
+			{
+				CalculateGlyphQuad(messageQuad, glyph)
+			};
+			if (quad)
+				RenderQueue::DrawQuad(*quad);
 		}
 	}
 
@@ -1053,6 +2032,107 @@ namespace BlastOff
 		return m_FontSize * c_SpacingPer24 / 24;
 	}
 
+	RenderQuad TextLineSprite::CalculateQuad() const
+	{
+		const Rect2f realRect = CalculateRealRect();
+		Rect2f drawRect =
+		{
+			m_CoordTransformer->ToScreenCoordinates(realRect)
+		};
+
+		// the colour used to be baked into the texture,
+		// so its alpha still has to count
+		const float opacity = (m_Colour.a / (float)0xFF) * m_Opacity;
+
+		const Vector2f drawOrigin = drawRect.GetSize() / 2.0f;
+		drawRect = drawRect.Translate(drawOrigin);
+
+		RenderQuad result = {};
+		result.texture = m_TextureLoader->GetGlyphAtlas();
+		result.destinationRect = drawRect;
+		result.origin = drawOrigin;
+		result.rotation = CalculateRealRotation();
+		result.tint = m_Colour.WithOpacity(opacity);
+		return result;
+	}
+
+	optional<RenderQuad> TextLineSprite::CalculateGlyphQuad(
+		const RenderQuad& messageQuad,
+		const GlyphPlacement& uncroppedGlyph
+	) const
+	{
+		const optional<GlyphPlacement> glyph = CropGlyph(uncroppedGlyph);
+		if (!glyph)
+			return std::nullopt;
+
+		const Rect2f messageRect = messageQuad.destinationRect;
+		const Vector2f scale = 
+		{
+			messageRect.w / m_Layout.size.x,
+			messageRect.h / m_Layout.size.y
+		};
+
+		const Rect2f layoutRect = glyph->layoutRect;
+		const Vector2f glyphOffset =
+		{
+			layoutRect.x * scale.x,
+			layoutRect.y * scale.y
+		};
+
+		// every glyph turns about the middle of the whole message,
+		// so the origin moves instead of the destination
+		RenderQuad result = messageQuad;
+		result.sourceRect = glyph->sourceRect;
+		result.destinationRect = Rect2f(
+			messageRect.x,
+			messageRect.y,
+			layoutRect.w * scale.x,
+			layoutRect.h * scale.y
+		);
+		result.origin = messageQuad.origin - glyphOffset;
+		return result;
+	}
+
+	optional<GlyphPlacement> TextLineSprite::CropGlyph
+		(const GlyphPlacement& glyph) const
+	{
+		if (m_Crop == Crop2f{ 0 })
+			return glyph;
+
+		// in layout space, where the crop is a fraction of the message
+		const Vector2f size = m_Layout.size;
+		const float cropLeft = m_Crop.left * size.x;
+		const float cropRight = (1 - m_Crop.right) * size.x;
+		const float cropTop = m_Crop.top * size.y;
+		const float cropBottom = (1 - m_Crop.bottom) * size.y;
+
+		const Rect2f layoutRect = glyph.layoutRect;
+		const float left = std::max(layoutRect.x, cropLeft);
+		const float right = std::min(layoutRect.x + layoutRect.w, cropRight);
+		const float top = std::max(layoutRect.y, cropTop);
+		const float bottom = std::min(layoutRect.y + layoutRect.h, cropBottom);
+		if ((right <= left) || (bottom <= top))
+			return std::nullopt;
+
+		// the source shrinks by the same fraction as the layout
+		const Rect2f sourceRect = glyph.sourceRect;
+		const Vector2f sourcePerLayout =
+		{
+			sourceRect.w / layoutRect.w,
+			sourceRect.h / layoutRect.h
+		};
+
+		GlyphPlacement result = {};
+		result.layoutRect = Rect2f(left, top, right - left, bottom - top);
+		result.sourceRect = Rect2f(
+			sourceRect.x + ((left - layoutRect.x) * sourcePerLayout.x),
+			sourceRect.y + ((top - layoutRect.y) * sourcePerLayout.y),
+			(right - left) * sourcePerLayout.x,
+			(bottom - top) * sourcePerLayout.y
+		);
+		return result;
+	}
+
 
 	TextSprite::TextSprite(
 		const Vector2f enginePosition,
@@ -1064,160 +2144,37 @@ namespace BlastOff
 		TextTextureLoader* const textureLoader,
 		const string& message,
 		const Sprite* const parent
-	) :
-		m_EnginePosition(enginePosition),
-		m_Colour(colour),
-		m_FontSize(fontSize),
-		m_LineSpacing(lineSpacing),
-		m_CoordTransformer(coordTransformer),
-		m_ProgramConstants(programConstants),
-		m_TextureLoader(textureLoader)
+	)
 	{
-		const auto createEmpty = 
-			[&, this]()
-			{
-				m_Empty = std::make_unique<Empty>(
-					enginePosition,
-					coordTransformer,
-					programConstants
-				);
-				m_Empty->SetParent(parent);
-			};
+		m_Sprite = std::make_unique<TextLineSprite>(
+			enginePosition,
+			colour,
+			fontSize,
+			coordTransformer,
+			programConstants,
+			textureLoader,
+			message
+		);
+		m_Sprite->SetParent(parent);
+		m_Sprite->SetLineSpacing(lineSpacing);
 
-		createEmpty();
-		InitializeLineSprites(message);
+		// so the engine size is right straight away
+		m_Sprite->Update();
 	}
 
 	void TextSprite::Update() 
 	{
-		for (TextLineSprite& lineSprite : m_LineSprites)
-			lineSprite.Update();
-
-		m_Empty->Update();
+		m_Sprite->Update();
 	}
 
-	void TextSprite::Draw() const
+	void TextSprite::Draw(RenderQueue* const renderQueue) const
 	{
-		for (const TextLineSprite& lineSprite : m_LineSprites)
-			lineSprite.Draw();
+		m_Sprite->Draw(renderQueue);
 	}
 
 	Vector2f TextSprite::CalculateEngineSize() const
 	{
-		const auto calculateWidth = 
-			[this]() -> float
-			{
-				float width = 0;
-				for (const LineSprite& lineSprite : m_LineSprites)
-				{
-					const Vector2f lineSize = lineSprite.GetEngineSize();
-					width = std::max(width, lineSize.x);
-				}
-				return width;
-			};
-
-		const auto calculateHeight = 
-			[this]()
-			{
-				const LineSprite& topLine = m_LineSprites.front();
-				const LineSprite& bottomLine = m_LineSprites.back();
-
-				const float top = topLine.GetEdgePosition(Direction::Up);
-				const float bottom = 
-				{
-					bottomLine.GetEdgePosition(Direction::Down)
-				};
-				return top - bottom;
-			};
-
-		return{ calculateWidth(), calculateHeight() };
-	}
-
-	void TextSprite::InitializeLineSprites(const string& message)
-	{
-		const auto createLineSprite = 
-			[this](const string& line)
-			{
-				constexpr Vector2f enginePosition = Vector2f::Zero();
-				m_LineSprites.emplace_back(
-					enginePosition,
-					m_Colour,
-					m_FontSize,
-					m_CoordTransformer,
-					m_ProgramConstants,
-					m_TextureLoader,
-					line.c_str()
-				);
-				LineSprite& back = m_LineSprites.back();
-				back.SetParent(m_Empty.get());
-				
-				// need to update the LineSprite
-				// to make sure that its engine rect is updated
-				back.Update();
-			};
-
-		const auto initializeVector = 
-			[&, this]()
-			{
-				m_LineSprites.clear();
-
-				const vector<string> lines = 
-				{
-					SplitString(message.c_str(), '\n')
-				};
-				m_LineSprites.reserve(lines.size());
-
-				for (const string& line : lines)
-					createLineSprite(line);
-
-				m_LineSprites.shrink_to_fit();
-			};
-
-		const auto calculateLineHeight = 
-			[this]() -> float
-			{
-				float result = 0;
-				for (const LineSprite& lineSprite : m_LineSprites) 
-				{
-					const Rect2f engineRect = lineSprite.GetEngineRect();
-					const float height = engineRect.h;
-					result = std::max(result, height);
-				}
-				return result;
-			};
-
-		const auto applyLineSpacing = 
-			[&, this]()
-			{
-				const float lineHeight = calculateLineHeight();
-				const float lineSpacing = lineHeight * m_LineSpacing;
-
-				for (size_t index = 0; index < m_LineSprites.size(); index++)
-				{
-					LineSprite& lineSprite = m_LineSprites.at(index);
-					const float yPosition = (-lineSpacing) * (float)index;
-					lineSprite.SetLocalPosition({ 0, yPosition });
-				}
-			};
-
-		const auto centerLines = 
-			[this]()
-			{
-				const LineSprite& topLine = m_LineSprites.front();
-				const LineSprite& bottomLine = m_LineSprites.back();
-
-				const float top = topLine.GetEngineRect().y;
-				const float bottom = bottomLine.GetEngineRect().y;
-
-				const float height = top - bottom;
-				const float yTranslation = height / 2.0f;
-				for (LineSprite& lineSprite : m_LineSprites)
-					lineSprite.Move({ 0, yTranslation });
-			};
-
-		initializeVector();
-		applyLineSpacing();
-		centerLines();
+		return m_Sprite->GetEngineSize();
 	}
 
 
@@ -1277,7 +2234,7 @@ namespace BlastOff
 
 	}
 
-	void RectangleSprite::Draw() const
+	void RectangleSprite::DrawImmediately() const
 	{
 		const Rect2f realRect = CalculateRealRect();
 		const Rect2f drawRect = 
@@ -1337,7 +2294,7 @@ namespace BlastOff
 		
 	}
 
-	void RoundedRectangleSprite::Draw() const
+	void RoundedRectangleSprite::DrawImmediately() const
 	{
 		const Rect2f realRect = CalculateRealRect();
 		const Rect2f drawRect = 
@@ -2,8 +2,11 @@
 
 #include "Utils.h"
 #include "ProgramConstants.h"
+#include "RenderQueue.h"
+#include "AssetManager.h"
 
 #include "raylib.h"
+#include <deque>
 
 namespace BlastOff
 {
@@ -24,7 +27,11 @@ namespace BlastOff
 
 	struct RayWindow
 	{
-		RayWindow(const Vector2i size, const string& title);
+		RayWindow(
+			const Vector2i size, 
+			const string& title, 
+			const bool isHeadless
+		);
 		~RayWindow();
 
 		void Update();
@@ -36,6 +43,10 @@ namespace BlastOff
 		void SetSize(const Vector2i size);
 
 	private:
+		// a headless window never opens, 
+		// and just remembers the size and position it was given
+		bool m_IsHeadless = false;
+
 		Vector2i m_Position = Vector2i::Zero();
 		Vector2i m_Size = Vector2i::Zero();
 
@@ -62,6 +73,9 @@ namespace BlastOff
 
 		Vector2f GetViewportSize() const;
 
+		// the part of the world the camera can see, in engine coordinates
+		Rect2f CalculateVisibleRect() const;
+
 		void Update();
 
 	private:
@@ -92,10 +106,10 @@ namespace BlastOff
 			const CoordinateTransformer* const coordTransformer,
 			const ProgramConstants* const programConstants
 		);
-		virtual ~Sprite()
-		{
+		Sprite(const Sprite& other);
+		virtual ~Sprite();
 
-		}
+		Sprite& operator=(const Sprite& other);
 
 		float GetEdgePosition(const Direction side) const;
 
@@ -134,11 +148,18 @@ namespace BlastOff
 
 		bool CollideWithLine(const Line2f line) const;
 
+		// conservative, so a rotated sprite is tested by a square
+		// that contains it at any angle
+		bool IsVisible(const Rect2f visibleRect) const;
+
 		void Move(const Vector2f translation);
 		void Rotate(const float rotation);
 
 		virtual void Update();
-		virtual void Draw() const = 0;
+
+		// hands the sprite to the queue, which draws it when flushed
+		virtual void Draw(RenderQueue* const renderQueue) const;
+		virtual void DrawImmediately() const = 0;
 
 	protected:
 		float m_LocalRotation = 0;
@@ -152,6 +173,24 @@ namespace BlastOff
 
 		const CoordinateTransformer* m_CoordTransformer = nullptr;
 		const ProgramConstants* m_ProgramConstants = nullptr;
+
+		// marks the real position and rotation of this sprite,
+		// and of every sprite under it, as needing recalculation
+		void InvalidateTransform() const;
+
+	private:
+		// the real transform is only recalculated once this sprite
+		// or one of its ancestors has changed. a dirty sprite always
+		// has dirty children, so invalidation stops at the first one
+		mutable bool m_IsTransformDirty = true;
+		mutable Vector2f m_CachedRealPosition = Vector2f::Zero();
+		mutable float m_CachedRealRotation = 0;
+
+		// every sprite whose parent is this one.
+		// a copy never takes the original's children
+		mutable vector<Sprite*> m_Children = {};
+
+		void UpdateCachedTransform() const;
 	};
 
 	struct Empty : public Sprite
@@ -162,7 +201,8 @@ namespace BlastOff
 			const ProgramConstants* const programConstants
 		);
 
-		void Draw() const override;
+		void Draw(RenderQueue* const renderQueue) const override;
+		void DrawImmediately() const override;
 
 	protected:
 		static Rect2f SetEnginePosition(const Vector2f enginePosition);
@@ -193,7 +233,7 @@ namespace BlastOff
 			const Direction direction
 		);
 
-		void Draw() const override;
+		void DrawImmediately() const override;
 
 	protected:
 		Colour4i m_FirstColour = c_White;
@@ -201,16 +241,108 @@ namespace BlastOff
 		Direction m_Direction = Direction::Down;
 	};
 
+	// the part of a texture that one image covers, in pixels.
+	// an image packed into an atlas only covers its own cell of it
+	struct TextureRegion
+	{
+		const Texture* texture = nullptr;
+		int x = 0;
+		int y = 0;
+		int width = 0;
+		int height = 0;
+
+		static TextureRegion FromTexture(const Texture* const texture);
+
+		Vector2i GetSize() const;
+	};
+
+	// a PNG decoded into memory, but not yet on the GPU
+	struct DecodedImage
+	{
+		string path = "";
+		Image image = { 0 };
+
+		// in nanoseconds, just for the decode
+		uint64_t loadTime = 0;
+
+		// points into the asset archive, so it's never freed
+		bool isMapped = false;
+
+		void Unload() const;
+	};
+
 	struct ImageTextureLoader
 	{
 		static const int c_DefaultTextureFiltering;
 
+		ImageTextureLoader(
+			AssetManager* const assetManager,
+			const bool isHeadless
+		);
 		~ImageTextureLoader();
-		const Texture* LazyLoadTexture(const char* const resourcePath);
+
+		// packs every image under resource/png into as few textures
+		// as possible, so sprites share them and raylib can batch
+		// their draws. does nothing for a headless loader
+		void BuildAtlases();
+
+		// the same, from images already decoded, which it unloads.
+		// anything too big for an atlas gets its own texture
+		void BuildAtlases(const vector<DecodedImage>& images);
+
+		// every image BuildAtlases() would pack, and so decode
+		vector<string> FindAtlasPaths() const;
+
+		// never touches the GPU, so any thread can call it.
+		// cooked images are already decoded, so they're used in place
+		optional<DecodedImage> DecodePNG(const string& resourcePath) const;
+
+		// uploads an image decoded elsewhere, then unloads it
+		const TextureRegion* InsertDecodedImage(const DecodedImage& decoded);
+
+		// resolving once and keeping the handle
+		// skips hashing the path on every later load
+		ImageHandle Resolve(const string_view resourcePath);
+
+		const TextureRegion* LazyLoadTexture(const ImageHandle handle);
+		const TextureRegion* LazyLoadTexture(const char* const resourcePath);
 
 	private:
-		unordered_map<string, Texture> m_CachedValues = {};
-		const Texture* LoadAndInsert(const char* const resourcePath);
+		static const char* const c_ResourceDirectory;
+		static const char* const c_ArchiveDirectory;
+
+		// no bigger than what the oldest GPUs we run on can sample
+		static const int c_AtlasSize;
+
+		// each cell's edge pixels are repeated this far out,
+		// so filtering never blends in a neighbour
+		static const int c_AtlasPadding;
+
+		// headless textures are never uploaded to the GPU.
+		// they only carry the image size, read from the PNG header
+		bool m_IsHeadless = false;
+
+		AssetManager* m_AssetManager = nullptr;
+
+		// owns every texture, atlas or not. 
+		// node-based, so the regions can point into it
+		unordered_map<string, Texture> m_Textures = {};
+
+		// indexed by handle. a deque, so growing it
+		// never moves a region someone already points to
+		std::deque<TextureRegion> m_Regions = {};
+
+		TextureRegion* GetRegion(const ImageHandle handle);
+		optional<Image> FindArchivedImage(const string_view resourcePath) const;
+		const TextureRegion* LoadAndInsert(const ImageHandle handle);
+	};
+
+	// a font rasterized into memory, but not yet on the GPU
+	struct DecodedFont
+	{
+		// everything but the texture
+		Font font = { 0 };
+		Image atlas = { 0 };
 	};
 
 	struct TextTextureParameters
@@ -219,33 +351,64 @@ namespace BlastOff
 		float spacing;
 		Colour4i colour;
 		string message;
+	};
 
-		bool operator==(const TextTextureParameters& other) const;
+	// where a glyph is in the font's atlas, and where it goes
+	// relative to the top left of its text, in texture pixels.
+	// both are top-left rects, like raylib's
+	struct GlyphPlacement
+	{
+		Rect2f sourceRect = Rect2f(0, 0, 0, 0);
+		Rect2f layoutRect = Rect2f(0, 0, 0, 0);
+	};
 
-		struct Hasher
-		{
-			size_t operator()(const TextTextureParameters& key) const;
-		};
+	struct TextLayout
+	{
+		vector<GlyphPlacement> glyphs = {};
+		Vector2f size = Vector2f::Zero();
 	};
 
 	struct TextTextureLoader
 	{
 		using Parameters = TextTextureParameters;
 
-		TextTextureLoader(const Font* const font);
-		~TextTextureLoader();
+		TextTextureLoader(const Font* const font, const bool isHeadless);
+
+		// only the glyph metrics are loaded, 
+		// so the font can measure text but never draw it
+		static Font LoadHeadlessFont(const char* const path, const int size);
+		static void UnloadHeadlessFont(const Font& font);
+
+		// rasterizes the glyphs and packs them the way LoadFontEx() does,
+		// but never touches the GPU, so any thread can call it
+		static optional<DecodedFont> DecodeFont(
+			const byte* const data, 
+			const size_t byteSize,
+			const int size
+		);
+
+		// uploads the atlas of a font decoded elsewhere, then unloads it
+		static Font InsertDecodedFont(const DecodedFont& decoded);
 
-		const Texture* LazyLoadTexture(const Parameters& parameters);
 		Vector2f Measure(const Parameters& parameters) const;
 
-	private:
-		using CacheMap = unordered_map<Parameters, Texture, Parameters::Hasher>;
+		// glyph by glyph, the way raylib would draw it. each line
+		// is centered on the widest one, and starts lineSpacing
+		// font sizes below the one before it
+		TextLayout LayOut(
+			const Parameters& parameters, 
+			const float lineSpacing
+		) const;
 
-		CacheMap m_CachedValues = {};
+		// every glyph in a layout is cut from this.
+		// headless fonts don't have one
+		const Texture* GetGlyphAtlas() const;
+
+	private:
 		const Font* m_Font;
 
-		const Texture* LoadAndInsert(const Parameters& parameters);
-		void CheckMessage(const char* const message);
+		// a headless font has glyph metrics, but no GPU texture
+		bool m_IsHeadless = false;
 	};
 
 	struct ImageSprite : public Sprite
@@ -254,12 +417,12 @@ namespace BlastOff
 			const Rect2f engineRect,
 			const CoordinateTransformer* const coordTransformer,
 			const ProgramConstants* const programConstants,
-			const Texture* const texture
+			const TextureRegion* const texture
 		);
 		ImageSprite(
 			const CoordinateTransformer* const coordTransformer,
 			const ProgramConstants* const programConstants,
-			const Texture* const texture
+			const TextureRegion* const texture
 		);
 
 		static unique_ptr<ImageSprite> LoadFromPath(
@@ -276,9 +439,14 @@ namespace BlastOff
 			ImageTextureLoader* imageTextureLoader
 		);
 
+		void SetTexture(const TextureRegion* const texture);
 		void SetTexture(const Texture* const texture);
 
-		void Draw() const override;
+		// a quad, so the queue can batch it with others of its texture
+		void Draw(RenderQueue* const renderQueue) const override;
+		void DrawImmediately() const override;
+
+		RenderQuad CalculateQuad() const;
 
 		Vector2f CalculateRealPosition() const override;
 		Vector2f CalculateRealSize() const override;
@@ -293,11 +461,14 @@ namespace BlastOff
 	protected:
 		static constexpr Colour4i c_DefaultDrawTint = c_White;
 
-		const Texture* m_Texture = nullptr;
+		TextureRegion m_Texture = {};
 		Crop2f m_Crop = { 0 };
 	};
 
-	struct TextLineSprite : public ImageSprite
+	// drawn a glyph at a time from the font's atlas, 
+	// so a new message never needs a new texture.
+	// each line of a message with newlines is centered
+	struct TextLineSprite : public Sprite
 	{
 		TextLineSprite(
 			const Vector2f enginePosition,
@@ -313,6 +484,10 @@ namespace BlastOff
 
 		void SetMessage(const string& message);
 
+		// in multiples of the font size
+		void SetLineSpacing(const float lineSpacing);
+		void SetCrop(const Crop2f crop);
+
 		void SetEngineRect(const Rect2f engineRect) override;
 
 		void SetScale(const float scale) override;
@@ -320,23 +495,42 @@ namespace BlastOff
 
 		void Update() override;
 
+		// a quad per glyph, all from the same texture, so they batch
+		void Draw(RenderQueue* const renderQueue) const override;
+		void DrawImmediately() const override;
+
 	protected:
 		using Parameters = TextTextureParameters;
 
 		static const float c_SpacingPer24;
 
-		bool m_ShouldRecacheTexture = true;
+		bool m_ShouldLayOut = true;
 
 		Colour4i m_Colour = c_White;
 		float m_FontSize = 0;
+		float m_LineSpacing = 1;
 		string m_Message = "";
 		TextTextureLoader* m_TextureLoader = nullptr;
 
+		TextLayout m_Layout = {};
+		Crop2f m_Crop = { 0 };
+
 		Parameters CalculateParameters() const;
 		float CalculateSpacing() const;
+
+		// the whole message as one quad, which each glyph is cut from
+		RenderQuad CalculateQuad() const;
+
+		// nothing if the glyph has been cropped out entirely
+		optional<RenderQuad> CalculateGlyphQuad(
+			const RenderQuad& messageQuad,
+			const GlyphPlacement& glyph
+		) const;
+		optional<GlyphPlacement> CropGlyph
+			(const GlyphPlacement& glyph) const;
 	};
 
-	// raylib is broken, so we need to draw one sprite per line
+	// lines spaced by a multiple of their height
 	struct TextSprite
 	{
 		TextSprite(
@@ -354,25 +548,10 @@ namespace BlastOff
 		Vector2f CalculateEngineSize() const;
 
 		void Update();
-		void Draw() const;
+		void Draw(RenderQueue* const renderQueue) const;
 
 	protected:
-		using LineSprite = TextLineSprite;
-
-		Vector2f m_EnginePosition;
-		Colour4i m_Colour;
-		float m_FontSize;
-		float m_LineSpacing;
-
-		const CoordinateTransformer* m_CoordTransformer;
-		const ProgramConstants* m_ProgramConstants;
-
-		unique_ptr<Empty> m_Empty = nullptr;
-		vector<LineSprite> m_LineSprites = {};
-
-		TextTextureLoader* m_TextureLoader;
-
-		void InitializeLineSprites(const string& message);
+		unique_ptr<TextLineSprite> m_Sprite = nullptr;
 	};
 
 	enum class ShapeSpriteType
@@ -394,7 +573,7 @@ namespace BlastOff
 
 		void SetColour(const Colour4i colour);
 
-		void Draw() const override = 0;
+		void DrawImmediately() const override = 0;
 
 	protected:
 		float CalculateScreenStrokeWidth() const;
@@ -417,7 +596,7 @@ namespace BlastOff
 			const optional<float> strokeWidth = std::nullopt
 		);
 
-		void Draw() const override;
+		void DrawImmediately() const override;
 	};
 
 	struct RoundedRectangleSprite : public ShapeSprite
@@ -431,7 +610,7 @@ namespace BlastOff
 			const optional<float> strokeWidth = std::nullopt
 		);
 
-		void Draw() const override;
+		void DrawImmediately() const override;
 
 	protected:
 		static const int c_Resolution;
@@ -7,6 +7,53 @@
 
 namespace BlastOff
 {
+    bool InputState::GetKeyDown(const int keyEnum) const
+    {
+        if ((keyEnum < 0) || (keyEnum >= (int)c_KeyCount))
+            return false;
+
+        return keysDown.test(keyEnum);
+    }
+
+    bool InputState::GetMouseButtonDown(const int buttonEnum) const
+    {
+        return TestButton(buttonEnum, buttonsDown);
+    }
+
+    bool InputState::GetMouseButtonPressed(const int buttonEnum) const
+    {
+        return TestButton(buttonEnum, buttonsPressed);
+    }
+
+    bool InputState::GetMouseButtonReleased(const int buttonEnum) const
+    {
+        return TestButton(buttonEnum, buttonsReleased);
+    }
+
+    void InputState::SetKeyDown(const int keyEnum, const bool isDown)
+    {
+        if ((keyEnum < 0) || (keyEnum >= (int)c_KeyCount))
+        {
+            const char* const message =
+            {
+                "InputState::SetKeyDown() failed: "
+                "Key enum is out of range."
+            };
+            Logging::LogWarning(message);
+            return;
+        }
+        keysDown.set(keyEnum, isDown);
+    }
+
+    bool InputState::TestButton(const int buttonEnum, const uint8_t buttons)
+    {
+        if ((buttonEnum < 0) || (buttonEnum >= c_ButtonCount))
+            return false;
+
+        return buttons & (1 << buttonEnum);
+    }
+
+
     InputManager::InputManager
         (const CoordinateTransformer* const coordTransformer) :
         m_CoordTransformer(coordTransformer)
@@ -14,124 +61,320 @@ namespace BlastOff
 
     }
 
-    void InputManager::Update()
+    bool InputManager::GetKeyDown(const int keyEnum) const
     {
-        // able to be overridden by base classes
+        return m_State.GetKeyDown(keyEnum);
     }
 
+    bool InputManager::GetMouseButtonDown(const int buttonEnum) const
+    {
+        return m_State.GetMouseButtonDown(buttonEnum);
+    }
 
-    PlayableInputManager::PlayableInputManager
-        (const CoordinateTransformer* const coordTransformer) :
-        InputManager(coordTransformer)
+    bool InputManager::GetMouseButtonPressed(const int buttonEnum) const
     {
+        return m_State.GetMouseButtonPressed(buttonEnum);
+    }
 
+    bool InputManager::GetMouseButtonReleased(const int buttonEnum) const
+    {
+        return m_State.GetMouseButtonReleased(buttonEnum);
     }
 
-    bool PlayableInputManager::GetKeyDown(const int keyEnum) const
+    Vector2f InputManager::CalculateMousePosition() const
     {
-        return IsKeyDown(keyEnum);
+        return m_State.mousePosition;
     }
 
-    bool PlayableInputManager::GetMouseButtonDown(const int buttonEnum) const
+    const InputState& InputManager::GetState() const
     {
-        return IsMouseButtonDown(buttonEnum);
+        return m_State;
     }
 
-    bool PlayableInputManager::GetMouseButtonPressed
-        (const int buttonEnum) const
+    void InputManager::Update()
     {
-        return IsMouseButtonPressed(buttonEnum);
+        InputState state = {};
+        Capture(&state);
+        m_State = state;
     }
 
-    bool PlayableInputManager::GetMouseButtonReleased
-        (const int buttonEnum) const
+    void InputManager::Reset(const uint64_t seed)
     {
-        return IsMouseButtonReleased(buttonEnum); 
-    }  
+        (void)seed;
+        m_State = {};
+    }
+
 
-    Vector2f PlayableInputManager::CalculateMousePosition() const
+    PlayableInputManager::PlayableInputManager
+        (const CoordinateTransformer* const coordTransformer) :
+        InputManager(coordTransformer)
     {
-        const optional<CursorPosition> cursor = GetCursorPosition();
-        if (!cursor)
-        {
-            const char* message = "GetCursorPosition() failed.";
-            Logging::LogWarning(message);
-            return Vector2f::Zero();
-        }
 
-        const Vector2i screenCoords(*cursor);
-        const Vector2f engineMouse =
-        {
-            m_CoordTransformer->ToEngineCoordinates(screenCoords)
-        };
-        return engineMouse;
+    }
+
+    void PlayableInputManager::Capture(InputState* const state)
+    {
+        const auto captureKeys =
+            [&]()
+            {
+                const int keyCount = (int)InputState::c_KeyCount;
+                for (int key = 0; key < keyCount; key++)
+                {
+                    if (IsKeyDown(key))
+                        state->keysDown.set(key);
+                }
+            };
+
+        const auto captureButtons =
+            [&]()
+            {
+                const int buttonCount = InputState::c_ButtonCount;
+                for (int button = 0; button < buttonCount; button++)
+                {
+                    const uint8_t bit = (uint8_t)(1 << button);
+                    if (IsMouseButtonDown(button))
+                        state->buttonsDown |= bit;
+                    if (IsMouseButtonPressed(button))
+                        state->buttonsPressed |= bit;
+                    if (IsMouseButtonReleased(button))
+                        state->buttonsReleased |= bit;
+                }
+            };
+
+        const auto captureCursor =
+            [&, this]()
+            {
+                const optional<CursorPosition> cursor = GetCursorPosition();
+                if (!cursor)
+                {
+                    const char* message = "GetCursorPosition() failed.";
+                    Logging::LogWarning(message);
+                    return;
+                }
+
+                const Vector2i screenCoords(*cursor);
+                state->screenMousePosition = screenCoords;
+                state->mousePosition =
+                {
+                    m_CoordTransformer->ToEngineCoordinates(screenCoords)
+                };
+            };
+
+        captureKeys();
+        captureButtons();
+        captureCursor();
     }
 
 
     CutsceneInputManager::CutsceneInputManager(
         const CoordinateTransformer* const coordTransformer,
         const Vector2f* const cameraPosition,
-        const ProgramConstants* const programConstants
+        const ProgramConstants* const programConstants,
+        RandomStream* const random
     ) :
         InputManager(coordTransformer),
         m_CameraPosition(cameraPosition),
-        m_ProgramConstants(programConstants)
+        m_ProgramConstants(programConstants),
+        m_Random(random)
     {
-        m_OscillationTick = c_MaxOscillationTick * GetRandomFloat();
+        m_OscillationTick = c_MaxOscillationTick * m_Random->NextFloat();
     }
 
-    bool CutsceneInputManager::GetKeyDown(const int keyEnum) const
+    void CutsceneInputManager::Reset(const uint64_t seed)
     {
-        return keyEnum == KEY_SPACE;
+        InputManager::Reset(seed);
+
+        m_OscillationTick = c_MaxOscillationTick * m_Random->NextFloat();
     }
 
-    bool CutsceneInputManager::GetMouseButtonDown(const int buttonEnum) const
+    void CutsceneInputManager::Capture(InputState* const state)
     {
-        (void)buttonEnum;
-        return false;
+        const auto advanceOscillation =
+            [this]()
+            {
+                m_OscillationTick += m_ProgramConstants->GetTargetFrametime();
+
+                const float max = c_MaxOscillationTick;
+                if (m_OscillationTick > max)
+                    m_OscillationTick -= max;
+            };
+
+        const auto calculateMousePosition =
+            [this]() -> Vector2f
+            {
+                constexpr Vector2f raiseAmount = { 0, 5 };
+
+                const float piRatio = c_MaxOscillationTick / c_Pi;
+                const float oscillationX =
+                {
+                    (sinf(m_OscillationTick / piRatio) * 2) - 1
+                };
+                constexpr float factor = 4 / 5.0f;
+                const Vector2f oscillation = { oscillationX * factor, 0 };
+
+                const Vector2f result =
+                {
+                    (*m_CameraPosition) + oscillation + raiseAmount
+                };
+                return result;
+            };
+
+        advanceOscillation();
+
+        // the cutscene holds space the whole time
+        state->SetKeyDown(KEY_SPACE, true);
+        state->mousePosition = calculateMousePosition();
     }
 
-    bool CutsceneInputManager::GetMouseButtonPressed
-        (const int buttonEnum) const
+    const float CutsceneInputManager::c_MaxOscillationTick = c_Pi * 2;
+
+
+    RecordingInputManager::RecordingInputManager(
+        const CoordinateTransformer* const coordTransformer,
+        unique_ptr<InputManager> source,
+        const uint64_t seed,
+        const string& path
+    ) :
+        InputManager(coordTransformer),
+        m_Source(std::move(source)),
+        m_Path(path)
     {
-        (void)buttonEnum;
-        return false;
+        m_Recording.seed = seed;
     }
 
-    bool CutsceneInputManager::GetMouseButtonReleased
-        (const int buttonEnum) const
+    RecordingInputManager::~RecordingInputManager()
     {
-        (void)buttonEnum;
-        return false;
+        Save();
     }
 
-    Vector2f CutsceneInputManager::CalculateMousePosition() const
+    void RecordingInputManager::Reset(const uint64_t seed)
     {
-        constexpr Vector2f raiseAmount = { 0, 5 };
+        InputManager::Reset(seed);
+        m_Source->Reset(seed);
 
-        const float piRatio = c_MaxOscillationTick / c_Pi;
-        const float oscillationX =
+        Save();
+
+        // cleared rather than replaced, to keep the capacity
+        m_Recording.seed = seed;
+        m_Recording.keys.clear();
+        m_Recording.ticks.clear();
+        m_HasDroppedKey = false;
+    }
+
+    void RecordingInputManager::Save() const
+    {
+        if (!m_Recording.SaveToPath(m_Path.c_str()))
+            return;
+
+        const string message =
         {
-            (sinf(m_OscillationTick / piRatio) * 2) - 1
+            "Saved " + std::to_string(m_Recording.ticks.size()) + " ticks "
+            "of input to \"" + m_Path + "\"."
         };
-        constexpr float factor = 4 / 5.0f;
-        const Vector2f oscillation = { oscillationX * factor, 0 };
+        Logging::Log(message.c_str());
+    }
 
-        const Vector2f result =
+    void RecordingInputManager::Capture(InputState* const state)
+    {
+        m_Source->Update();
+        *state = m_Source->GetState();
+
+        const auto dropKey =
+            [&, this](const size_t key)
+            {
+                // the game sees what the replay will, 
+                // so the recording still matches what was played
+                state->keysDown.reset(key);
+
+                if (m_HasDroppedKey)
+                    return;
+
+                m_HasDroppedKey = true;
+                const string message =
+                {
+                    "RecordingInputManager::Capture() failed: "
+                    "There's no room left to record key " + 
+                    std::to_string(key) + ", so it's ignored, "
+                    "along with any other new keys, until the next game."
+                };
+                Logging::LogWarning(message.c_str());
+            };
+
+        // only keys that are held down need a bit,
+        // since a key without one always reads as up
+        InputSnapshot snapshot = {};
+        for (size_t key = 0; key < InputState::c_KeyCount; key++)
         {
-            (*m_CameraPosition) + oscillation + raiseAmount
-        };
-        return result;
+            if (!state->keysDown.test(key))
+                continue;
+
+            const uint64_t bit = m_Recording.FindOrAddKey((int)key);
+            if (bit)
+                snapshot.keysDown |= bit;
+            else
+                dropKey(key);
+        }
+        snapshot.buttonsDown = state->buttonsDown;
+        snapshot.buttonsPressed = state->buttonsPressed;
+        snapshot.buttonsReleased = state->buttonsReleased;
+        snapshot.mousePosition = state->mousePosition;
+
+        m_Recording.ticks.push_back(snapshot);
     }
 
-    void CutsceneInputManager::Update()
+
+    ReplayInputManager::ReplayInputManager(
+        const CoordinateTransformer* const coordTransformer,
+        const InputRecording* const recording
+    ) :
+        InputManager(coordTransformer),
+        m_Recording(recording)
     {
-        m_OscillationTick += m_ProgramConstants->GetTargetFrametime();
 
-        const float max = c_MaxOscillationTick;
-        if (m_OscillationTick > max)
-            m_OscillationTick -= max;
     }
 
-    const float CutsceneInputManager::c_MaxOscillationTick = c_Pi * 2;
+    void ReplayInputManager::Reset(const uint64_t seed)
+    {
+        InputManager::Reset(seed);
+
+        m_UpdateCount = 0;
+    }
+
+    bool ReplayInputManager::IsFinished() const
+    {
+        return m_UpdateCount > m_Recording->ticks.size();
+    }
+
+    void ReplayInputManager::Capture(InputState* const state)
+    {
+        const vector<InputSnapshot>& ticks = m_Recording->ticks;
+        if (m_UpdateCount >= ticks.size())
+        {
+            if (m_UpdateCount == ticks.size())
+                Logging::Log("Replay finished.");
+
+            // the cursor stays wherever it was last
+            state->mousePosition = m_State.mousePosition;
+            m_UpdateCount++;
+            return;
+        }
+
+        const InputSnapshot& snapshot = ticks.at(m_UpdateCount);
+        const vector<int>& keys = m_Recording->keys;
+        for (size_t index = 0; index < keys.size(); index++)
+        {
+            const uint64_t bit = ((uint64_t)1) << index;
+            if (snapshot.keysDown & bit)
+                state->SetKeyDown(keys.at(index), true);
+        }
+        state->buttonsDown = snapshot.buttonsDown;
+        state->buttonsPressed = snapshot.buttonsPressed;
+        state->buttonsReleased = snapshot.buttonsReleased;
+
+        // a recording only holds the engine position,
+        // so the screen position is left at zero
+        state->mousePosition = snapshot.mousePosition;
+
+        m_UpdateCount++;
+    }
 }
@@ -1,6 +1,13 @@
+#pragma once
+
 #include "Graphics.h"
 #include "ProgramConstants.h"
 #include "Utils.h"
+#include "Random.h"
+#include "InputRecording.h"
+#include "OperatingSystem.h"
+
+#include <bitset>
 
 namespace BlastOff
 {
@@ -12,6 +19,35 @@ namespace BlastOff
     //
     // - Andrew C.
 
+    // everything a tick's input can be asked about.
+    // captured once per tick by InputManager::Update(), so every query
+    // in the tick agrees, and none of them touch raylib or the OS
+    struct InputState
+    {
+        // raylib never uses a key enum past this
+        static constexpr size_t c_KeyCount = 512;
+        static constexpr int c_ButtonCount = 8;
+
+        std::bitset<c_KeyCount> keysDown = {};
+
+        // bit N refers to mouse button enum N
+        uint8_t buttonsDown = 0;
+        uint8_t buttonsPressed = 0;
+        uint8_t buttonsReleased = 0;
+
+        Vector2i screenMousePosition = Vector2i::Zero();
+        Vector2f mousePosition = Vector2f::Zero();
+
+        bool GetKeyDown(const int keyEnum) const;
+        bool GetMouseButtonDown(const int buttonEnum) const;
+        bool GetMouseButtonPressed(const int buttonEnum) const;
+        bool GetMouseButtonReleased(const int buttonEnum) const;
+
+        void SetKeyDown(const int keyEnum, const bool isDown);
+
+        static bool TestButton(const int buttonEnum, const uint8_t buttons);
+    };
+
     struct InputManager
     {
         InputManager(const CoordinateTransformer* const coordTransformer);
@@ -20,17 +56,28 @@ namespace BlastOff
 
         }
 
-        virtual bool GetKeyDown(const int keyEnum) const = 0;
-        virtual bool GetMouseButtonDown(const int buttonEnum) const = 0;
-        virtual bool GetMouseButtonPressed(const int buttonEnum) const = 0;
-        virtual bool GetMouseButtonReleased(const int buttonEnum) const = 0;
+        bool GetKeyDown(const int keyEnum) const;
+        bool GetMouseButtonDown(const int buttonEnum) const;
+        bool GetMouseButtonPressed(const int buttonEnum) const;
+        bool GetMouseButtonReleased(const int buttonEnum) const;
 
-        virtual Vector2f CalculateMousePosition() const = 0;
+        Vector2f CalculateMousePosition() const;
 
-        virtual void Update();
+        const InputState& GetState() const;
+
+        // should be called once at the start of every tick,
+        // after the coordinate transformer has been updated
+        void Update();
+
+        // called when the game using it starts over with a new seed
+        virtual void Reset(const uint64_t seed);
 
     protected:
         const CoordinateTransformer* const m_CoordTransformer = nullptr;
+
+        InputState m_State = {};
+
+        virtual void Capture(InputState* const state) = 0;
     };
 
     struct PlayableInputManager : public InputManager
@@ -38,12 +85,8 @@ namespace BlastOff
         PlayableInputManager
             (const CoordinateTransformer* const coordTransformer);
 
-        bool GetKeyDown(const int keyEnum) const override;
-        bool GetMouseButtonDown(const int buttonEnum) const override;
-        bool GetMouseButtonPressed(const int buttonEnum) const override;
-        bool GetMouseButtonReleased(const int buttonEnum) const override;
-
-        Vector2f CalculateMousePosition() const override;
+    protected:
+        void Capture(InputState* const state) override;
     };
 
     struct CutsceneInputManager : public InputManager
@@ -51,24 +94,76 @@ namespace BlastOff
         CutsceneInputManager(
             const CoordinateTransformer* const coordTransformer,
             const Vector2f* const cameraPosition,
-            const ProgramConstants* const programConstants
+            const ProgramConstants* const programConstants,
+            RandomStream* const random
         );
 
-        bool GetKeyDown(const int keyEnum) const override;
-        bool GetMouseButtonDown(const int buttonEnum) const override;
-        bool GetMouseButtonPressed(const int buttonEnum) const override;
-        bool GetMouseButtonReleased(const int buttonEnum) const override;
-
-        Vector2f CalculateMousePosition() const override;
-
-        void Update() override;
+        void Reset(const uint64_t seed) override;
 
     protected:
         static const float c_MaxOscillationTick;
 
         const Vector2f* m_CameraPosition;
         const ProgramConstants* m_ProgramConstants;
+        RandomStream* m_Random;
 
         float m_OscillationTick = 0;
+
+        void Capture(InputState* const state) override;
+    };
+
+    // wraps another input manager, and remembers every tick
+    // it captures. the recording is saved once the game is destroyed,
+    // or reset, so the file always holds the most recent game
+    struct RecordingInputManager : public InputManager
+    {
+        RecordingInputManager(
+            const CoordinateTransformer* const coordTransformer,
+            unique_ptr<InputManager> source,
+            const uint64_t seed,
+            const string& path
+        );
+        ~RecordingInputManager() override;
+
+        void Reset(const uint64_t seed) override;
+
+    protected:
+        unique_ptr<InputManager> m_Source = nullptr;
+        string m_Path;
+        InputRecording m_Recording = {};
+
+        // only warned about once per recording
+        bool m_HasDroppedKey = false;
+
+        void Capture(InputState* const state) override;
+        void Save() const;
     };
+
+    // plays back a recording tick by tick.
+    // once it runs out, nothing is held down
+    struct ReplayInputManager : public InputManager
+    {
+        ReplayInputManager(
+            const CoordinateTransformer* const coordTransformer,
+            const InputRecording* const recording
+        );
+
+        bool IsFinished() const;
+
+        // plays the recording from the start again
+        void Reset(const uint64_t seed) override;
+
+    protected:
+        const InputRecording* m_Recording = nullptr;
+
+        uint64_t m_UpdateCount = 0;
+
+        void Capture(InputState* const state) override;
+    };
+
+    // lets a game decide when its input manager is created,
+    // without deciding what kind it is
+    using InputManagerFactory = function<
+        unique_ptr<InputManager>(const CoordinateTransformer* const)
+    >;
 }
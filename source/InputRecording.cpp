@@ -0,0 +1,321 @@
+#include "InputRecording.h"
+#include "Logging.h"
+
+#include <cstring>
+#include <fstream>
+
+namespace BlastOff
+{
+    namespace
+    {
+        enum ChangeFlag : uint8_t
+        {
+            KeysChanged = 1 << 0,
+            ButtonsDownChanged = 1 << 1,
+            ButtonsPressedChanged = 1 << 2,
+            ButtonsReleasedChanged = 1 << 3,
+            MouseChanged = 1 << 4
+        };
+
+        uint8_t CalculateChanges(
+            const InputSnapshot& previous,
+            const InputSnapshot& current
+        )
+        {
+            uint8_t result = 0;
+            if (current.keysDown != previous.keysDown)
+                result |= KeysChanged;
+            if (current.buttonsDown != previous.buttonsDown)
+                result |= ButtonsDownChanged;
+            if (current.buttonsPressed != previous.buttonsPressed)
+                result |= ButtonsPressedChanged;
+            if (current.buttonsReleased != previous.buttonsReleased)
+                result |= ButtonsReleasedChanged;
+
+            const Vector2f previousMouse = previous.mousePosition;
+            const Vector2f currentMouse = current.mousePosition;
+            if ((currentMouse.x != previousMouse.x) ||
+                (currentMouse.y != previousMouse.y))
+                result |= MouseChanged;
+
+            return result;
+        }
+    }
+
+    optional<InputRecording> InputRecording::LoadFromPath
+        (const char* const path)
+    {
+        const auto logFailure =
+            [&](const char* const reason)
+            {
+                const string message =
+                {
+                    "InputRecording::LoadFromPath() failed: "
+                    "File at path \"" + string(path) + "\" " + reason
+                };
+                Logging::LogWarning(message.c_str());
+            };
+
+        std::ifstream reader(path, std::ios::binary);
+        if (!reader)
+        {
+            logFailure("could not be opened.");
+            return std::nullopt;
+        }
+
+        std::stringstream readBuffer;
+        readBuffer << reader.rdbuf();
+        const string bytes = readBuffer.str();
+        size_t cursor = 0;
+
+        const auto read =
+            [&](auto* const destination) -> bool
+            {
+                const size_t size = sizeof(*destination);
+                if ((cursor + size) > bytes.size())
+                    return false;
+
+                std::memcpy(destination, bytes.data() + cursor, size);
+                cursor += size;
+                return true;
+            };
+
+        const auto readHeader =
+            [&](InputRecording* const recording, uint64_t* const tickCount)
+                -> bool
+            {
+                const size_t magicLength = strlen(c_Magic);
+                if (bytes.compare(0, magicLength, c_Magic) != 0)
+                    return false;
+                cursor += magicLength;
+
+                uint32_t version = 0;
+                uint32_t keyCount = 0;
+                if (!read(&version) || (version != c_Version))
+                    return false;
+                if (!read(&recording->seed) || !read(tickCount))
+                    return false;
+                if (!read(&keyCount) || (keyCount > c_MaxKeyCount))
+                    return false;
+
+                recording->keys.resize(keyCount);
+                for (int& key : recording->keys)
+                {
+                    int32_t value = 0;
+                    if (!read(&value))
+                        return false;
+
+                    key = value;
+                }
+                return true;
+            };
+
+        const auto readChangedFields =
+            [&](const uint8_t changes, InputSnapshot* const snapshot) -> bool
+            {
+                if ((changes & KeysChanged) && !read(&snapshot->keysDown))
+                    return false;
+                if ((changes & ButtonsDownChanged) &&
+                    !read(&snapshot->buttonsDown))
+                    return false;
+                if ((changes & ButtonsPressedChanged) &&
+                    !read(&snapshot->buttonsPressed))
+                    return false;
+                if ((changes & ButtonsReleasedChanged) &&
+                    !read(&snapshot->buttonsReleased))
+                    return false;
+
+                if (changes & MouseChanged)
+                {
+                    Vector2f& mouse = snapshot->mousePosition;
+                    if (!read(&mouse.x) || !read(&mouse.y))
+                        return false;
+                }
+                return true;
+            };
+
+        const auto readTicks =
+            [&](InputRecording* const recording, const uint64_t tickCount)
+                -> bool
+            {
+                // a corrupt count shouldn't be able to exhaust memory,
+                // and no tick takes up less than a bit of a byte
+                const size_t remaining = bytes.size() - cursor;
+                if (tickCount > (remaining * (c_MaxRepeatCount + 1)))
+                    return false;
+
+                recording->ticks.reserve(tickCount);
+
+                InputSnapshot snapshot = {};
+                while (recording->ticks.size() < tickCount)
+                {
+                    uint8_t header = 0;
+                    if (!read(&header))
+                        return false;
+
+                    if (header & c_RepeatFlag)
+                    {
+                        const size_t repeatCount =
+                        {
+                            (size_t)(header & c_MaxRepeatCount) + 1
+                        };
+                        for (size_t index = 0; index < repeatCount; index++)
+                            recording->ticks.push_back(snapshot);
+                    }
+                    else
+                    {
+                        if (!readChangedFields(header, &snapshot))
+                            return false;
+
+                        recording->ticks.push_back(snapshot);
+                    }
+                }
+                return recording->ticks.size() == tickCount;
+            };
+
+        InputRecording result;
+        uint64_t tickCount = 0;
+        if (!readHeader(&result, &tickCount))
+        {
+            logFailure("has an invalid header.");
+            return std::nullopt;
+        }
+        if (!readTicks(&result, tickCount))
+        {
+            logFailure("is truncated or corrupt.");
+            return std::nullopt;
+        }
+        return result;
+    }
+
+    bool InputRecording::SaveToPath(const char* const path) const
+    {
+        string bytes = c_Magic;
+
+        const auto write =
+            [&](const auto value)
+            {
+                const char* const data = (const char*)&value;
+                bytes.append(data, sizeof(value));
+            };
+
+        const auto writeHeader =
+            [&, this]()
+            {
+                write(c_Version);
+                write(seed);
+                write((uint64_t)ticks.size());
+                write((uint32_t)keys.size());
+                for (const int key : keys)
+                    write((int32_t)key);
+            };
+
+        const auto writeChangedFields =
+            [&](const uint8_t changes, const InputSnapshot& snapshot)
+            {
+                write(changes);
+                if (changes & KeysChanged)
+                    write(snapshot.keysDown);
+                if (changes & ButtonsDownChanged)
+                    write(snapshot.buttonsDown);
+                if (changes & ButtonsPressedChanged)
+                    write(snapshot.buttonsPressed);
+                if (changes & ButtonsReleasedChanged)
+                    write(snapshot.buttonsReleased);
+                if (changes & MouseChanged)
+                {
+                    write(snapshot.mousePosition.x);
+                    write(snapshot.mousePosition.y);
+                }
+            };
+
+        const auto writeTicks =
+            [&, this]()
+            {
+                InputSnapshot previous = {};
+                size_t repeatCount = 0;
+
+                const auto flushRepeats =
+                    [&]()
+                    {
+                        if (!repeatCount)
+                            return;
+
+                        write((uint8_t)(c_RepeatFlag | (repeatCount - 1)));
+                        repeatCount = 0;
+                    };
+
+                for (const InputSnapshot& snapshot : ticks)
+                {
+                    const uint8_t changes =
+                    {
+                        CalculateChanges(previous, snapshot)
+                    };
+                    if (changes)
+                    {
+                        flushRepeats();
+                        writeChangedFields(changes, snapshot);
+                    }
+                    else
+                    {
+                        repeatCount++;
+                        if (repeatCount == (size_t)c_MaxRepeatCount + 1)
+                            flushRepeats();
+                    }
+                    previous = snapshot;
+                }
+                flushRepeats();
+            };
+
+        writeHeader();
+        writeTicks();
+
+        std::ofstream output(path, std::ios::binary);
+        output.write(bytes.data(), bytes.size());
+        if (!output)
+        {
+            const string message =
+            {
+                "InputRecording::SaveToPath() failed: "
+                "Unable to write to path \"" + string(path) + "\"."
+            };
+            Logging::LogWarning(message.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    uint64_t InputRecording::FindOrAddKey(const int keyEnum)
+    {
+        const uint64_t existing = FindKey(keyEnum);
+        if (existing)
+            return existing;
+
+        if (keys.size() >= c_MaxKeyCount)
+            return 0;
+
+        keys.push_back(keyEnum);
+        return ((uint64_t)1) << (keys.size() - 1);
+    }
+
+    uint64_t InputRecording::FindKey(const int keyEnum) const
+    {
+        for (size_t index = 0; index < keys.size(); index++)
+        {
+            if (keys.at(index) == keyEnum)
+                return ((uint64_t)1) << index;
+        }
+        return 0;
+    }
+
+    // the file is written in the machine's byte order,
+    // since every platform BlastOff targets is little-endian
+    const char* const InputRecording::c_Magic = "BLSTRPLY";
+    const uint32_t InputRecording::c_Version = 1;
+
+    // one bit per key in InputSnapshot::keysDown
+    const size_t InputRecording::c_MaxKeyCount = 64;
+
+    const uint8_t InputRecording::c_RepeatFlag = 1 << 7;
+    const uint8_t InputRecording::c_MaxRepeatCount = 0x7F;
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "Utils.h"
+
+namespace BlastOff
+{
+    // all the input a game observed during one tick
+    struct InputSnapshot
+    {
+        // bit N refers to the Nth key in InputRecording::keys
+        uint64_t keysDown = 0;
+
+        // bit N refers to mouse button enum N
+        uint8_t buttonsDown = 0;
+        uint8_t buttonsPressed = 0;
+        uint8_t buttonsReleased = 0;
+
+        Vector2f mousePosition = Vector2f::Zero();
+    };
+
+    // every tick of input from one game, along with the seed it was
+    // played with. replaying both reproduces the game exactly.
+    //
+    // on disk, each tick only stores the fields that changed since the
+    // previous one, and runs of unchanged ticks collapse into one byte
+    struct InputRecording
+    {
+        uint64_t seed = 0;
+        vector<int> keys = {};
+        vector<InputSnapshot> ticks = {};
+
+        static optional<InputRecording> LoadFromPath(const char* const path);
+        bool SaveToPath(const char* const path) const;
+
+        // returns the bit for the key, registering it if it's new.
+        // returns zero if there's no room for another key,
+        // and leaves it to the caller to say so
+        uint64_t FindOrAddKey(const int keyEnum);
+        uint64_t FindKey(const int keyEnum) const;
+
+    private:
+        static const char* const c_Magic;
+        static const uint32_t c_Version;
+        static const size_t c_MaxKeyCount;
+        static const uint8_t c_RepeatFlag;
+        static const uint8_t c_MaxRepeatCount;
+    };
+}
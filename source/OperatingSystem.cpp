@@ -10,8 +10,15 @@
 
 #if COMPILE_TARGET_LINUX
 	#include <X11/Xlib.h>
+
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
 #endif
 
+#include <fstream>
+
 namespace BlastOff
 {
 	namespace
@@ -19,9 +26,34 @@ namespace BlastOff
 #if COMPILE_TARGET_LINUX
 		namespace Linux
 		{
+			// opening a display is a round trip to the X server,
+			// so only one is ever opened, and it stays open until exit
+			struct DisplayConnection
+			{
+				DisplayConnection() :
+					display(XOpenDisplay(nullptr))
+				{
+
+				}
+
+				~DisplayConnection()
+				{
+					if (display)
+						XCloseDisplay(display);
+				}
+
+				Display* const display = nullptr;
+			};
+
+			Display* GetDisplay()
+			{
+				static const DisplayConnection connection;
+				return connection.display;
+			}
+
 			optional<CursorPosition> GetCursorPosition()
 			{
-				Display* display = XOpenDisplay(nullptr);
+				Display* const display = GetDisplay();
 				if (!display)
 					return std::nullopt;
 				
@@ -42,7 +74,6 @@ namespace BlastOff
 					&windowY, 
 					&maskReturn
 				);
-				XCloseDisplay(display);
 				return CursorPosition{ cursorX, cursorY };
 			}
 		}
@@ -104,4 +135,110 @@ namespace BlastOff
 		return Linux::GetCursorPosition();
 #endif
 	}
+
+	unique_ptr<MappedFile> MappedFile::Open(const char* const path)
+	{
+		unique_ptr<MappedFile> result(new MappedFile());
+
+#if COMPILE_TARGET_WINDOWS
+		const HANDLE file = CreateFileA(
+			path,
+			GENERIC_READ,
+			FILE_SHARE_READ,
+			nullptr,
+			OPEN_EXISTING,
+			FILE_ATTRIBUTE_NORMAL,
+			nullptr
+		);
+		if (file == INVALID_HANDLE_VALUE)
+			return nullptr;
+
+		// closed by the destructor, from here on
+		result->m_FileHandle = file;
+
+		LARGE_INTEGER size = { 0 };
+		if ((!GetFileSizeEx(file, &size)) || (!size.QuadPart))
+			return nullptr;
+
+		const HANDLE mapping = 
+		{
+			CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr)
+		};
+		if (!mapping)
+			return nullptr;
+
+		result->m_MappingHandle = mapping;
+
+		const void* const view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		if (!view)
+			return nullptr;
+
+		result->m_Data = (const uint8_t*)view;
+		result->m_Size = (size_t)size.QuadPart;
+#elif COMPILE_TARGET_LINUX
+		const int file = open(path, O_RDONLY);
+		if (file < 0)
+			return nullptr;
+
+		struct stat status = { 0 };
+		const bool hasSize = 
+		{
+			(fstat(file, &status) == 0) && (status.st_size > 0)
+		};
+		void* const view =
+		{
+			hasSize ?
+				mmap(nullptr, status.st_size, PROT_READ, MAP_PRIVATE, file, 0) :
+				MAP_FAILED
+		};
+
+		// the mapping keeps the file open on its own
+		close(file);
+		if (view == MAP_FAILED)
+			return nullptr;
+
+		result->m_Data = (const uint8_t*)view;
+		result->m_Size = (size_t)status.st_size;
+#else
+		std::ifstream file(path, std::ios::binary | std::ios::ate);
+		if (!file)
+			return nullptr;
+
+		vector<uint8_t>& buffer = result->m_Buffer;
+		buffer.resize((size_t)file.tellg());
+		file.seekg(0);
+		file.read((char*)buffer.data(), (std::streamsize)buffer.size());
+		if ((!file) || buffer.empty())
+			return nullptr;
+
+		result->m_Data = buffer.data();
+		result->m_Size = buffer.size();
+#endif
+		return result;
+	}
+
+	MappedFile::~MappedFile()
+	{
+#if COMPILE_TARGET_WINDOWS
+		if (m_Data)
+			UnmapViewOfFile(m_Data);
+		if (m_MappingHandle)
+			CloseHandle(m_MappingHandle);
+		if (m_FileHandle)
+			CloseHandle(m_FileHandle);
+#elif COMPILE_TARGET_LINUX
+		if (m_Data)
+			munmap((void*)m_Data, m_Size);
+#endif
+	}
+
+	const uint8_t* MappedFile::GetData() const
+	{
+		return m_Data;
+	}
+
+	size_t MappedFile::GetSize() const
+	{
+		return m_Size;
+	}
 }
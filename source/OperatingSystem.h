@@ -3,6 +3,8 @@
 #include <optional>
 #include <string>
 #include <memory>
+#include <vector>
+#include <cstdint>
 
 #ifdef _WIN32
 #define COMPILE_TARGET_WINDOWS _WIN32
@@ -24,6 +26,7 @@ namespace BlastOff
 {
 	using std::optional, std::unique_ptr;
 	using std::string;
+	using std::vector;
 
 	struct CursorPosition
 	{
@@ -36,4 +39,31 @@ namespace BlastOff
 	optional<CursorPosition> GetCursorPosition();
 
 	string GetFontPath(const char* const name, const char* const extension);
+
+	// a whole file, read-only. mapped into memory where the platform 
+	// allows, so only the pages actually touched are ever read
+	struct MappedFile
+	{
+		// nullptr if the file is missing or empty
+		static unique_ptr<MappedFile> Open(const char* const path);
+
+		MappedFile(const MappedFile&) = delete;
+		~MappedFile();
+
+		const uint8_t* GetData() const;
+		size_t GetSize() const;
+
+	private:
+		MappedFile() = default;
+
+		const uint8_t* m_Data = nullptr;
+		size_t m_Size = 0;
+
+		// windows needs both handles kept until it's unmapped
+		void* m_FileHandle = nullptr;
+		void* m_MappingHandle = nullptr;
+
+		// where nothing can be mapped, the file is read into this instead
+		vector<uint8_t> m_Buffer = {};
+	};
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include "Graphics.h"
 #include "OperatingSystem.h"
 #include "Props.h"
+#include "Profiler.h"
 #include "Utils.h"
 #include "Logging.h"
 
@@ -70,12 +71,15 @@ namespace BlastOff
 		const GameOutcome* const gameOutcome,
 		const Rect2f* const worldBounds,
 		const SpawnPlatform* const spawnPlatform,
-		const vector<FloatingPlatform*>* const floatingPlatforms,
+		const ArenaVector<FloatingPlatform*>* const floatingPlatforms,
+		VerticalIndex* const floatingPlatformIndex,
 		const CoordinateTransformer* const coordTransformer,
 		const GameConstants* const gameConstants,
 		const ProgramConstants* const programConstants,
 		const InputManager* const inputManager,
-		ImageTextureLoader* const imageTextureLoader
+		ImageTextureLoader* const imageTextureLoader,
+		RandomStream* const random,
+		RandomStream* const effectsRandom
 	) :
 		m_MaximumFuel(10),
 		m_MaxSpeedupTick(5),
@@ -83,10 +87,13 @@ namespace BlastOff
 		m_WorldBounds(worldBounds),
 		m_SpawnPlatform(spawnPlatform),
 		m_FloatingPlatforms(floatingPlatforms),
+		m_FloatingPlatformIndex(floatingPlatformIndex),
 		m_CoordTransformer(coordTransformer),
 		m_GameConstants(gameConstants),
 		m_ProgramConstants(programConstants),
-		m_InputManager(inputManager)
+		m_InputManager(inputManager),
+		m_Random(random),
+		m_EffectsRandom(effectsRandom)
 	{
 		const auto initializeConfig =
 			[&, this]()
@@ -138,6 +145,7 @@ namespace BlastOff
 					{ spaceshipHeight * aspectRatio, spaceshipHeight }
 				);
 				m_Spaceship->SetEngineRect(engineRect);
+				m_SpawnPosition = engineRect.GetPosition();
 			};
 
 		const auto initializeSpaceshipFlame =
@@ -188,6 +196,8 @@ namespace BlastOff
 
 	void Player::Update()
 	{
+		PROFILE_ZONE("Player::Update");
+
 		const auto calculateMouseOffset =
 			[this]() -> optional<Vector2f>
 			{
@@ -275,7 +285,7 @@ namespace BlastOff
 			[this]()
 			{
 				if (IsRunningOnFumes())
-					m_ThrustAcceleration *= GetRandomFloat();
+					m_ThrustAcceleration *= m_Random->NextFloat();
 			};
 
 		const auto applyThrustAcceleration =
@@ -562,19 +572,54 @@ namespace BlastOff
 				}
 			};
 
+		// a platform only collides with a spaceship that was above it
+		// last pass and is below its top now, so only platforms
+		// between those two heights need to be checked
+		const auto findNearbyPlatforms =
+			[this]() -> const vector<size_t>&
+			{
+				const Rect2f engineRect = m_Spaceship->GetEngineRect();
+				const Vector2f previousPosition = 
+				{
+					m_MostRecentPlatformPosition.value_or(
+						engineRect.GetPosition()
+					)
+				};
+				const float halfHeight = engineRect.h / 2.0f;
+				const float bottom = 
+				{
+					std::min(engineRect.y, previousPosition.y) - halfHeight
+				};
+				const float top = 
+				{
+					std::max(engineRect.y, previousPosition.y) + halfHeight
+				};
+				return m_FloatingPlatformIndex->Query(bottom, top);
+			};
+
 		const auto applyFloatingPlatformCollisions = 
 			[&, this]()
 			{
-				for (FloatingPlatform* platform : *m_FloatingPlatforms)
+				for (const size_t index : findNearbyPlatforms())
 				{
+					const FloatingPlatform* const platform = 
+					{
+						m_FloatingPlatforms->at(index)
+					};
 					const Rect2f engineRect = m_Spaceship->GetEngineRect();
 					const optional<Edge2f> collision = 
 					{
-						platform->CollideWithPlayer(engineRect)
+						platform->CollideWithPlayer(
+							engineRect, 
+							m_MostRecentPlatformPosition
+						)
 					};
 					if (collision)
 						applyPropYCollision(*collision);
 				}
+
+				const Rect2f engineRect = m_Spaceship->GetEngineRect();
+				m_MostRecentPlatformPosition = engineRect.GetPosition();
 			};
 
 		const auto calculateVelocityForRotation =
@@ -619,7 +664,7 @@ namespace BlastOff
 
 					if (m_FramesThrusted % framesBetweenUpdates == 0)
 					{
-						const float newOpacity = GetRandomFloat();
+						const float newOpacity = m_EffectsRandom->NextFloat();
 						m_SpaceshipFlame->SetOpacity(newOpacity);
 					}
 					m_FramesThrusted++;
@@ -647,9 +692,12 @@ namespace BlastOff
 
 		if (!m_IsFrozen)
 		{
-			applyWorldBoundCollisions();
-			applySpawnPlatformCollisions();
-			applyFloatingPlatformCollisions();
+			{
+				PROFILE_ZONE("Player::Update collisions");
+				applyWorldBoundCollisions();
+				applySpawnPlatformCollisions();
+				applyFloatingPlatformCollisions();
+			}
 			applyRotation();
 			updateThrustAcceleration();
 			updateFuel();
@@ -664,12 +712,34 @@ namespace BlastOff
 		fadeSpaceshipFlame();
 	}
 
-	void Player::Draw() const
+	void Player::Draw(RenderQueue* const renderQueue) const
 	{
 		if (IsThrusting())
-			m_SpaceshipFlame->Draw();
+			m_SpaceshipFlame->Draw(renderQueue);
 
-		m_Spaceship->Draw();
+		m_Spaceship->Draw(renderQueue);
+	}
+
+	void Player::Reset()
+	{
+		m_DidCollideHorizontally = false;
+		m_DidCollideVertically = false;
+		m_BottomCollision = false;
+		m_IsFrozen = false;
+
+		m_FramesThrusted = c_DeactivatedTick;
+		m_StationaryFrameCount = c_DeactivatedTick;
+
+		m_CurrentFuel = m_MaximumFuel;
+		m_SpeedupTick = c_DeactivatedTick;
+
+		m_Velocity = Vector2f::Zero();
+		m_MostRecentPlatformPosition = std::nullopt;
+		m_ThrustAcceleration = Vector2f::Zero();
+
+		m_Spaceship->SetLocalPosition(m_SpawnPosition);
+		m_Spaceship->SetLocalRotation(0);
+		m_SpaceshipFlame->SetOpacity(1);
 	}
 
 	void Player::Freeze()
@@ -750,6 +820,15 @@ namespace BlastOff
 		return m_Velocity;
 	}
 
+	vector<string> Player::GetTexturePaths()
+	{
+		return
+		{
+			c_SpaceshipTexturePath,
+			c_FlameTexturePath
+		};
+	}
+
 	const char* const Player::c_SpaceshipTexturePath = 
 	{
 		"player/spaceship.png"
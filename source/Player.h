@@ -6,6 +6,8 @@
 #include "GameConstants.h"
 #include "Props.h"
 #include "InputManager.h"
+#include "VerticalIndex.h"
+#include "Arena.h"
 
 namespace BlastOff
 {
@@ -43,12 +45,15 @@ namespace BlastOff
 			const GameOutcome* const gameOutcome,
 			const Rect2f* const worldBounds,
 			const SpawnPlatform* const spawnPlatform,
-			const vector<FloatingPlatform*>* const floatingPlatforms,
+			const ArenaVector<FloatingPlatform*>* const floatingPlatforms,
+			VerticalIndex* const floatingPlatformIndex,
 			const CoordinateTransformer* const coordTransformer,
 			const GameConstants* const gameConstants,
 			const ProgramConstants* const programConstants,
 			const InputManager* const inputManager,
-			ImageTextureLoader* const imageTextureLoader
+			ImageTextureLoader* const imageTextureLoader,
+			RandomStream* const random,
+			RandomStream* const effectsRandom
 		);
 
 		bool IsStationary() const;
@@ -57,8 +62,11 @@ namespace BlastOff
 		float GetFuelRatio() const;
 		float GetSpeedUpRatio() const;
 
+		// back on the spawn platform, as if newly constructed
+		void Reset();
+
 		void Update();
-		void Draw() const;
+		void Draw(RenderQueue* const renderQueue) const;
 
 		void Freeze();
 		void Unfreeze();
@@ -76,11 +84,13 @@ namespace BlastOff
 
 		Vector2f GetVelocity() const;
 
+		static vector<string> GetTexturePaths();
+
 	private:
 		static const char* const c_SpaceshipTexturePath;
 		static const char* const c_FlameTexturePath;
 
-		static inline unique_ptr<const PlayerConfig> m_Config = nullptr;
+		unique_ptr<const PlayerConfig> m_Config = nullptr;
 
 		bool m_DidCollideHorizontally = false;
 		bool m_DidCollideVertically = false;
@@ -97,6 +107,11 @@ namespace BlastOff
 		float m_MaxSpeedupTick = 0;
 
 		Vector2f m_Velocity = Vector2f::Zero();
+		Vector2f m_SpawnPosition = Vector2f::Zero();
+
+		// where the spaceship was during the last platform collision pass,
+		// so platforms can tell whether it fell through them since
+		optional<Vector2f> m_MostRecentPlatformPosition = std::nullopt;
 		Vector2f m_ThrustAcceleration = Vector2f::Zero();
 
 		unique_ptr<ImageSprite> m_Spaceship;
@@ -105,12 +120,18 @@ namespace BlastOff
 		const Rect2f* m_WorldBounds = nullptr;
 		const GameOutcome* m_GameOutcome = nullptr;
 		const SpawnPlatform* m_SpawnPlatform = nullptr;
-		const vector<FloatingPlatform*>* m_FloatingPlatforms = nullptr;
+		const ArenaVector<FloatingPlatform*>* m_FloatingPlatforms = nullptr;
+		VerticalIndex* m_FloatingPlatformIndex = nullptr;
 		const CoordinateTransformer* m_CoordTransformer = nullptr;
 		const ProgramConstants* m_ProgramConstants = nullptr;
 		const GameConstants* m_GameConstants = nullptr;
 		const InputManager* m_InputManager = nullptr;
 
+		// the flame flicker is purely cosmetic,
+		// so it mustn't disturb the stream the physics draws from
+		RandomStream* m_Random = nullptr;
+		RandomStream* m_EffectsRandom = nullptr;
+
 		bool IsThrusting() const;
 		bool IsGoingTooFast() const;
 		bool IsGrounded() const;
@@ -4,277 +4,358 @@
 
 namespace BlastOff
 {
-	void Powerup::Update()
+	void SpeedUpPowerup::OnCollection(Player* const player)
 	{
-		const auto updateRotation =
-			[this]()
-			{
-				const float targetFrametime =
-				{
-					m_ProgramConstants->GetTargetFrametime()
-				};
-				m_RotationTick += 180.0f * targetFrametime;
+		player->RefillSpeedup(c_EnergyAmount);
+	}
 
-				if (m_RotationTick >= 360)
-					m_RotationTick -= 360;
+	const size_t SpeedUpPowerup::c_Count = 10;
+	const bool SpeedUpPowerup::c_SpawningEnabled = true;
 
-				const float tickInRadians = ToRadians(m_RotationTick);
-				const float rotation = m_OscillationScale * sinf(tickInRadians);
+	const char* const SpeedUpPowerup::c_TexturePath =
+	{
+		"powerup/speedupPowerup.png"
+	};
 
-				m_Sprite->SetLocalRotation(rotation);
-			};
+	const float SpeedUpPowerup::c_MaxCollectionTick = 0.5f;
+	const float SpeedUpPowerup::c_OscillationScale = 10;
+	const float SpeedUpPowerup::c_EnergyAmount = 1;
+	const Vector2f SpeedUpPowerup::c_DefaultEngineSize = { 1, 1 };
 
-		const auto updateCollection =
-			[this]()
-			{
-				const float progress = m_CollectionTick / m_MaxCollectionTick;
-				const float opacity = progress;
-				const float scale = progress;
 
-				m_Sprite->SetOpacity(opacity);
-				m_Sprite->SetScale(scale);
+	void FuelUpPowerup::OnCollection(Player* const player)
+	{
+		player->Refuel(c_EnergyAmount);
+	}
 
-				const float frametime = m_ProgramConstants->GetTargetFrametime();
-				m_CollectionTick -= frametime;
-			};
+	const size_t FuelUpPowerup::c_Count = 10;
+	const bool FuelUpPowerup::c_SpawningEnabled = true;
 
-		updateRotation();
+	const char* const FuelUpPowerup::c_TexturePath =
+	{
+		"powerup/fuelupPowerup.png"
+	};
 
-		if (WasRecentlyCollected())
-			updateCollection();
-	}
+	const float FuelUpPowerup::c_MaxCollectionTick = 0.5f;
+	const float FuelUpPowerup::c_OscillationScale = 10;
+	const float FuelUpPowerup::c_EnergyAmount = 2 / 3.0f;
+	const Vector2f FuelUpPowerup::c_DefaultEngineSize = { 1, 1 };
 
-	void Powerup::Draw() const
-	{
-		if (!m_Sprite)
-		{
-			const char* const message =
-			{
-				"Powerup::Draw() failed: "
-				"m_Sprite was not defined in sub-class implementation."
-			};
-			Logging::LogWarning(message);
-		}
-		else
-			m_Sprite->Draw();
-	}
 
-	void Powerup::OnCollection()
+	void DownforcePowerup::OnCollection(Player* const player)
 	{
-		m_CollectionTick = m_MaxCollectionTick;
-		m_IsCollected = true;
+		player->MultiplyVelocity(c_ForceMultiplier);
 	}
 
-	bool Powerup::IsCollected() const
+	const size_t DownforcePowerup::c_Count = 8;
+	const bool DownforcePowerup::c_SpawningEnabled = false;
+
+	const char* const DownforcePowerup::c_TexturePath =
 	{
-		return m_IsCollected;
-	}
+		"powerup/downforcePowerup.png"
+	};
 
-	Powerup::Powerup(
-		const CoordinateTransformer* const coordTransformer,
-		const ProgramConstants* const programConstants,
-		Player* const player,
+	const float DownforcePowerup::c_MaxCollectionTick = 0.5f;
+	const float DownforcePowerup::c_OscillationScale = 10;
+	const float DownforcePowerup::c_ForceMultiplier = 1 / 4.0f;
+	const Vector2f DownforcePowerup::c_DefaultEngineSize = { 1, 1 };
+
+
+	template <typename Type>
+	PowerupPool<Type>::PowerupPool(
 		ImageTextureLoader* const imageTextureLoader,
-		const Vector2f enginePosition,
-		const char* const texturePath,
-		const float maxCollectionTick,
-		const float oscillationScale,
-		const Vector2f defaultEngineSize
+		Arena* const arena
 	) :
-		m_Player(player),
-		m_ProgramConstants(programConstants),
-		m_MaxCollectionTick(maxCollectionTick),
-		m_OscillationScale(oscillationScale),
-		m_DefaultEngineSize(defaultEngineSize)
+		m_States(arena->GetResource()),
+		m_ImageTextureLoader(imageTextureLoader)
 	{
-		const auto initializeSprite =
-			[&, this]()
-			{
-				const Texture* const texture =
-				{
-					imageTextureLoader->LazyLoadTexture(texturePath)
-				};
-				const Rect2f engineRect(
-					enginePosition,
-					defaultEngineSize
-				);
-				m_Sprite = std::make_unique<ImageSprite>(
-					engineRect,
-					coordTransformer,
-					programConstants,
-					texture
-				);
-			};
 
-		initializeSprite();
 	}
 
-	Circle2f Powerup::GetCircle() const
+	template <typename Type>
+	void PowerupPool<Type>::Reserve(const size_t length)
 	{
-		const Rect2f engineRect = m_Sprite->GetEngineRect();
-		const Vector2f enginePosition = engineRect.GetPosition();
+		m_States.reserve(length);
+	}
+
+	template <typename Type>
+	void PowerupPool<Type>::Add(const Vector2f enginePosition)
+	{
+		// only loaded once there's something to draw with it
+		if (!m_Texture)
+		{
+			m_Texture = m_ImageTextureLoader->LazyLoadTexture(
+				Type::c_TexturePath
+			);
+		}
 
-		const Vector2f engineSize = engineRect.GetSize();
+		const Vector2f engineSize = Type::c_DefaultEngineSize;
 		const float averageDimension = (engineSize.x + engineSize.y) / 2.0f;
-		const float radius = averageDimension / 2.0f;
 
-		return Circle2f(enginePosition, radius);
+		PowerupState state = {};
+		state.position = enginePosition;
+		state.radius = averageDimension / 2.0f;
+		m_States.push_back(state);
 	}
 
-	bool Powerup::CircleCollideWithPlayer() const
+	template <typename Type>
+	void PowerupPool<Type>::Clear()
 	{
-		const Rect2f playerRect = m_Player->GetEngineRect();
-		const Circle2f circle = GetCircle();
-
-		return circle.CollideWithRect(playerRect);
+		m_States.clear();
 	}
 
-	bool Powerup::WasRecentlyCollected() const
+	template <typename Type>
+	void PowerupPool<Type>::Update(const float frametime)
 	{
-		return m_CollectionTick >= 0;
-	}
+		const float maxCollectionTick = Type::c_MaxCollectionTick;
 
+		// the rotation itself is worked out when drawing,
+		// so only the visible ones pay for the sine
+		for (PowerupState& state : m_States)
+		{
+			state.rotationTick += 180.0f * frametime;
+			if (state.rotationTick >= 360)
+				state.rotationTick -= 360;
 
-	SpeedUpPowerup::SpeedUpPowerup(
-		const CoordinateTransformer* const coordTransformer,
-		const ProgramConstants* const programConstants,
+			if (state.collectionTick >= 0)
+			{
+				state.scale = state.collectionTick / maxCollectionTick;
+				state.collectionTick -= frametime;
+			}
+		}
+	}
+
+	template <typename Type>
+	void PowerupPool<Type>::CollideWithPlayer(
 		Player* const player,
-		ImageTextureLoader* const imageTextureLoader,
-		const Vector2f enginePosition
-	) :
-		Powerup(
-			coordTransformer,
-			programConstants,
-			player,
-			imageTextureLoader,
-			enginePosition,
-			c_TexturePath,
-			c_MaxCollectionTick,
-			c_OscillationScale,
-			c_DefaultEngineSize
-		)
+		const Rect2f playerRect,
+		const size_t index
+	)
 	{
+		PowerupState& state = m_States[index];
+		if (state.isCollected)
+			return;
 
-	}
+		const Circle2f circle(state.position, state.radius);
+		if (!circle.CollideWithRect(playerRect))
+			return;
 
-	bool SpeedUpPowerup::CollideWithPlayer() const
-	{
-		return CircleCollideWithPlayer();
+		state.collectionTick = Type::c_MaxCollectionTick;
+		state.isCollected = true;
+		Type::OnCollection(player);
 	}
 
-	void SpeedUpPowerup::OnCollection()
+	template <typename Type>
+	size_t PowerupPool<Type>::Draw(
+		RenderQueue* const renderQueue,
+		const CoordinateTransformer* const coordTransformer,
+		const Rect2f visibleRect
+	) const
 	{
-		Powerup::OnCollection();
+		size_t result = 0;
+
+		const auto isVisible =
+			[&](Rect2f realRect, const float rotation) -> bool
+			{
+				if (rotation != 0)
+				{
+					const float diagonal = realRect.GetSize().Magnitude();
+					realRect = Rect2f(
+						realRect.GetPosition(),
+						{ diagonal, diagonal }
+					);
+				}
+				return realRect.CollideWithRect(visibleRect);
+			};
+
+		// mirrors ImageSprite::CalculateQuad(), without a crop
+		const auto calculateQuad =
+			[&, this](
+				const PowerupState& state,
+				const Rect2f realRect,
+				const float rotation
+			)
+			{
+				Rect2f drawRect =
+				{
+					coordTransformer->ToScreenCoordinates(realRect)
+				};
 
-		m_Player->RefillSpeedup(c_EnergyAmount);
+				const Vector2f drawOrigin = drawRect.GetSize() / 2.0f;
+				drawRect = drawRect.Translate(drawOrigin);
+
+				RenderQuad quad = {};
+				quad.texture = m_Texture->texture;
+				quad.sourceRect = Rect2f(
+					(float)m_Texture->x,
+					(float)m_Texture->y,
+					(float)m_Texture->width,
+					(float)m_Texture->height
+				);
+				quad.destinationRect = drawRect;
+				quad.origin = drawOrigin;
+				quad.rotation = rotation;
+				quad.tint = c_White.WithOpacity(state.scale);
+				return quad;
+			};
+
+		for (const PowerupState& state : m_States)
+		{
+			const float tickInRadians = ToRadians(state.rotationTick);
+			const float rotation =
+			{
+				Type::c_OscillationScale * sinf(tickInRadians)
+			};
+			const Rect2f realRect(
+				state.position,
+				Type::c_DefaultEngineSize * state.scale
+			);
+			if (!isVisible(realRect, rotation))
+				continue;
+
+			renderQueue->Submit(calculateQuad(state, realRect, rotation));
+			result++;
+		}
+		return result;
 	}
 
-	const size_t SpeedUpPowerup::c_Count = 10;
-	const bool SpeedUpPowerup::c_SpawningEnabled = true;
+	template <typename Type>
+	Rect2f PowerupPool<Type>::CalculateBounds(const size_t index) const
+	{
+		const PowerupState& state = m_States[index];
+		const Circle2f circle(state.position, state.radius);
+		return circle.CalculateBoundingBox();
+	}
 
-	const char* const SpeedUpPowerup::c_TexturePath = 
+	template <typename Type>
+	size_t PowerupPool<Type>::GetCount() const
 	{
-		"powerup/speedupPowerup.png"
-	};
+		return m_States.size();
+	}
 
-	const float SpeedUpPowerup::c_MaxCollectionTick = 0.5f;
-	const float SpeedUpPowerup::c_OscillationScale = 10;
-	const float SpeedUpPowerup::c_EnergyAmount = 1;
-	const Vector2f SpeedUpPowerup::c_DefaultEngineSize = { 1, 1 };
+	template struct PowerupPool<SpeedUpPowerup>;
+	template struct PowerupPool<FuelUpPowerup>;
+	template struct PowerupPool<DownforcePowerup>;
 
 
-	FuelUpPowerup::FuelUpPowerup(
+	PowerupField::PowerupField(
 		const CoordinateTransformer* const coordTransformer,
 		const ProgramConstants* const programConstants,
 		Player* const player,
 		ImageTextureLoader* const imageTextureLoader,
-		const Vector2f enginePosition
+		Arena* const arena
 	) :
-		Powerup(
-			coordTransformer,
-			programConstants,
-			player,
-			imageTextureLoader,
-			enginePosition,
-			c_TexturePath,
-			c_MaxCollectionTick,
-			c_OscillationScale,
-			c_DefaultEngineSize
+		m_CoordTransformer(coordTransformer),
+		m_ProgramConstants(programConstants),
+		m_Player(player),
+		m_Pools(
+			{ imageTextureLoader, arena },
+			{ imageTextureLoader, arena },
+			{ imageTextureLoader, arena }
 		)
 	{
 
 	}
 
-	bool FuelUpPowerup::CollideWithPlayer() const
+	void PowerupField::Update()
 	{
-		return CircleCollideWithPlayer();
+		const float frametime = m_ProgramConstants->GetTargetFrametime();
+		ForEachPool(
+			[&](auto& pool)
+			{
+				pool.Update(frametime);
+			}
+		);
 	}
 
-	void FuelUpPowerup::OnCollection()
+	void PowerupField::Clear()
 	{
-		Powerup::OnCollection();
-
-		m_Player->Refuel(c_EnergyAmount);
+		ForEachPool(
+			[](auto& pool)
+			{
+				pool.Clear();
+			}
+		);
 	}
 
-	const size_t FuelUpPowerup::c_Count = 10;
-	const bool FuelUpPowerup::c_SpawningEnabled = true;
-
-	const char* const FuelUpPowerup::c_TexturePath = 
-	{
-		"powerup/fuelupPowerup.png"
-	};
-
-	const float FuelUpPowerup::c_MaxCollectionTick = 0.5f;
-	const float FuelUpPowerup::c_OscillationScale = 10;
-	const float FuelUpPowerup::c_EnergyAmount = 2 / 3.0f;
-	const Vector2f FuelUpPowerup::c_DefaultEngineSize = { 1, 1 };
-
-
-	DownforcePowerup::DownforcePowerup(
-		const CoordinateTransformer* const coordTransformer,
-		const ProgramConstants* const programConstants,
-		Player* const player,
-		ImageTextureLoader* const imageTextureLoader,
-		const Vector2f enginePosition
-	) :
-		Powerup(
-			coordTransformer,
-			programConstants,
-			player,
-			imageTextureLoader,
-			enginePosition,
-			c_TexturePath,
-			c_MaxCollectionTick,
-			c_OscillationScale,
-			c_DefaultEngineSize
-		)
+	void PowerupField::CollideWithPlayer(const vector<size_t>& indices)
 	{
+		const Rect2f playerRect = m_Player->GetEngineRect();
 
+		// the indices are sorted, so each pool's are all together
+		size_t cursor = 0;
+		size_t poolStart = 0;
+		ForEachPool(
+			[&, this](auto& pool)
+			{
+				const size_t poolEnd = poolStart + pool.GetCount();
+				while (cursor < indices.size() && indices[cursor] < poolEnd)
+				{
+					const size_t index = indices[cursor] - poolStart;
+					pool.CollideWithPlayer(m_Player, playerRect, index);
+					cursor++;
+				}
+				poolStart = poolEnd;
+			}
+		);
 	}
 
-	bool DownforcePowerup::CollideWithPlayer() const
+	size_t PowerupField::Draw(
+		RenderQueue* const renderQueue,
+		const Rect2f visibleRect
+	) const
 	{
-		return CircleCollideWithPlayer();
+		size_t result = 0;
+		ForEachPool(
+			[&, this](const auto& pool)
+			{
+				result += pool.Draw(
+					renderQueue,
+					m_CoordTransformer,
+					visibleRect
+				);
+			}
+		);
+		return result;
 	}
 
-	void DownforcePowerup::OnCollection()
+	Rect2f PowerupField::CalculateBounds(const size_t index) const
 	{
-		Powerup::OnCollection();
+		optional<Rect2f> result = std::nullopt;
+		size_t poolStart = 0;
+		ForEachPool(
+			[&](const auto& pool)
+			{
+				const size_t poolEnd = poolStart + pool.GetCount();
+				if (!result && index < poolEnd)
+					result = pool.CalculateBounds(index - poolStart);
 
-		m_Player->MultiplyVelocity(c_ForceMultiplier);
-	}	
+				poolStart = poolEnd;
+			}
+		);
 
-	const size_t DownforcePowerup::c_Count = 8;
-	const bool DownforcePowerup::c_SpawningEnabled = false;
+		if (!result)
+		{
+			const string message =
+			{
+				"PowerupField::CalculateBounds() failed: "
+				"Index " + std::to_string(index) + " is out of range."
+			};
+			Logging::LogWarning(message.c_str());
+			return Rect2f(0, 0, 0, 0);
+		}
+		return *result;
+	}
 
-	const char* const DownforcePowerup::c_TexturePath = 
+	size_t PowerupField::GetCount() const
 	{
-		"powerup/downforcePowerup.png"
-	};
-
-	const float DownforcePowerup::c_MaxCollectionTick = 0.5f;
-	const float DownforcePowerup::c_OscillationScale = 10;
-	const float DownforcePowerup::c_ForceMultiplier = 1 / 4.0f;
-	const Vector2f DownforcePowerup::c_DefaultEngineSize = { 1, 1 };
+		size_t result = 0;
+		ForEachPool(
+			[&](const auto& pool)
+			{
+				result += pool.GetCount();
+			}
+		);
+		return result;
+	}
 }
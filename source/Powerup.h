@@ -5,123 +5,182 @@
 #include "Graphics.h"
 #include "Player.h"
 
+#include <tuple>
+
 namespace BlastOff
 {
-	struct Powerup
+	// everything a powerup's update and collision touch,
+	// kept small so a whole type's worth sits in one array
+	struct PowerupState
 	{
-		virtual bool CollideWithPlayer() const = 0;
-		virtual void OnCollection();
-		virtual void Update();
-		virtual void Draw() const;
+		Vector2f position = Vector2f::Zero();
+		float radius = 0;
 
-		bool IsCollected() const;
+		float rotationTick = 0;
+		float collectionTick = c_DeactivatedTick;
 
-	protected:
-		bool m_IsCollected = false;
+		// also the opacity, since both shrink after collection
+		float scale = 1;
+		bool isCollected = false;
+	};
 
-		float m_CollectionTick = c_DeactivatedTick;
-		float m_RotationTick = 0;
-		
-		const ProgramConstants* m_ProgramConstants = nullptr;
+	// a type of powerup is just its constants and its effect,
+	// which PowerupPool calls directly instead of through a vtable
+	struct SpeedUpPowerup
+	{
+		static void OnCollection(Player* const player);
 
-		Player* m_Player = nullptr;
+		static const size_t c_Count;
+		static const bool c_SpawningEnabled;
 
-		unique_ptr<Sprite> m_Sprite = nullptr;
+		static const char* const c_TexturePath;
+		static const float c_MaxCollectionTick;
+		static const float c_OscillationScale;
+		static const Vector2f c_DefaultEngineSize;
 
-		Powerup(
-			const CoordinateTransformer* const coordTransformer,
-			const ProgramConstants* const programConstants,
-			Player* const player,
-			ImageTextureLoader* const imageTextureLoader,
-			const Vector2f enginePosition,
-			const char* const texturePath,
-			const float maxCollectionTick,
-			const float oscillationScale,
-			const Vector2f defaultEngineSize
-		);
+	private:
+		static const float c_EnergyAmount;
+	};
+
+	struct FuelUpPowerup
+	{
+		static void OnCollection(Player* const player);
 
-		Circle2f GetCircle() const;
-		bool CircleCollideWithPlayer() const;
+		static const size_t c_Count;
+		static const bool c_SpawningEnabled;
 
-		bool WasRecentlyCollected() const;
+		static const char* const c_TexturePath;
+		static const float c_MaxCollectionTick;
+		static const float c_OscillationScale;
+		static const Vector2f c_DefaultEngineSize;
 
 	private:
-		float m_MaxCollectionTick = 0;
-		float m_OscillationScale = 0;
-		Vector2f m_DefaultEngineSize = Vector2f::Zero();
+		static const float c_EnergyAmount;
 	};
 
-	struct SpeedUpPowerup : public Powerup
+	struct DownforcePowerup
 	{
-		SpeedUpPowerup(
-			const CoordinateTransformer* const coordTransformer,
-			const ProgramConstants* const programConstants,
-			Player* const player,
-			ImageTextureLoader* const imageTextureLoader,
-			const Vector2f enginePosition
-		);
+		static void OnCollection(Player* const player);
 
-		bool CollideWithPlayer() const override;
-		void OnCollection() override;
-		
 		static const size_t c_Count;
 		static const bool c_SpawningEnabled;
 
-	private:
 		static const char* const c_TexturePath;
-
 		static const float c_MaxCollectionTick;
 		static const float c_OscillationScale;
-		static const float c_EnergyAmount;
 		static const Vector2f c_DefaultEngineSize;
+
+	private:
+		static const float c_ForceMultiplier;
 	};
 
-	struct FuelUpPowerup : public Powerup
+	// every powerup of one type. the texture is the only thing
+	// drawing needs that updating doesn't, so it's kept once, apart
+	template <typename Type>
+	struct PowerupPool
 	{
-		FuelUpPowerup(
-			const CoordinateTransformer* const coordTransformer,
-			const ProgramConstants* const programConstants,
-			Player* const player,
+		PowerupPool(
 			ImageTextureLoader* const imageTextureLoader,
-			const Vector2f enginePosition
+			Arena* const arena
 		);
 
-		bool CollideWithPlayer() const override;
-		void OnCollection() override;
-		
-		static const size_t c_Count;
-		static const bool c_SpawningEnabled;
-	
+		void Reserve(const size_t length);
+		void Add(const Vector2f enginePosition);
+
+		// keeps the texture and the capacity for the next batch
+		void Clear();
+
+		void Update(const float frametime);
+		void CollideWithPlayer(
+			Player* const player,
+			const Rect2f playerRect,
+			const size_t index
+		);
+
+		// returns how many were visible, and so submitted
+		size_t Draw(
+			RenderQueue* const renderQueue,
+			const CoordinateTransformer* const coordTransformer,
+			const Rect2f visibleRect
+		) const;
+
+		// everything the powerup can collide with
+		Rect2f CalculateBounds(const size_t index) const;
+		size_t GetCount() const;
+
 	private:
-		static const char* const c_TexturePath;
+		ArenaVector<PowerupState> m_States;
 
-		static const float c_MaxCollectionTick;
-		static const float c_OscillationScale;
-		static const float c_EnergyAmount;
-		static const Vector2f c_DefaultEngineSize;
+		ImageTextureLoader* m_ImageTextureLoader = nullptr;
+		const TextureRegion* m_Texture = nullptr;
 	};
 
-	struct DownforcePowerup : public Powerup
+	// every powerup in the game, one pool per type.
+	// indices run through the pools in order,
+	// so speedups come first and downforces last
+	struct PowerupField
 	{
-		DownforcePowerup(
+		PowerupField(
 			const CoordinateTransformer* const coordTransformer,
 			const ProgramConstants* const programConstants,
 			Player* const player,
 			ImageTextureLoader* const imageTextureLoader,
-			const Vector2f enginePosition
+			Arena* const arena
 		);
 
-		bool CollideWithPlayer() const override;
-		void OnCollection() override;
-		
-		static const size_t c_Count;
-		static const bool c_SpawningEnabled;
+		void Update();
+		void Clear();
+
+		// collects whichever of these touch the player.
+		// the indices have to be sorted
+		void CollideWithPlayer(const vector<size_t>& indices);
+
+		// returns how many were visible, and so submitted
+		size_t Draw(
+			RenderQueue* const renderQueue,
+			const Rect2f visibleRect
+		) const;
+
+		Rect2f CalculateBounds(const size_t index) const;
+		size_t GetCount() const;
+
+		template <typename Type>
+		PowerupPool<Type>& GetPool()
+		{
+			return std::get<PowerupPool<Type>>(m_Pools);
+		}
 
 	private:
-		static const char* const c_TexturePath;
-		static const float c_MaxCollectionTick;
-		static const float c_OscillationScale;
-		static const float c_ForceMultiplier;
-		static const Vector2f c_DefaultEngineSize;
+		const CoordinateTransformer* m_CoordTransformer = nullptr;
+		const ProgramConstants* m_ProgramConstants = nullptr;
+		Player* m_Player = nullptr;
+
+		std::tuple<
+			PowerupPool<SpeedUpPowerup>,
+			PowerupPool<FuelUpPowerup>,
+			PowerupPool<DownforcePowerup>
+		> m_Pools;
+
+		template <typename Function>
+		void ForEachPool(const Function& function)
+		{
+			const auto callForEach =
+				[&](auto&... pools)
+				{
+					(function(pools), ...);
+				};
+			std::apply(callForEach, m_Pools);
+		}
+
+		template <typename Function>
+		void ForEachPool(const Function& function) const
+		{
+			const auto callForEach =
+				[&](const auto&... pools)
+				{
+					(function(pools), ...);
+				};
+			std::apply(callForEach, m_Pools);
+		}
 	};
 }
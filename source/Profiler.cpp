@@ -0,0 +1,209 @@
+#include "Profiler.h"
+#include "Logging.h"
+
+#include <mutex>
+
+namespace BlastOff
+{
+	namespace
+	{
+		constexpr size_t c_MaxZoneCount = 256;
+		constexpr size_t c_FrameHistoryLength = 120;
+
+		// zone zero collects everything
+		// that couldn't be given a zone of its own
+		constexpr ProfileZoneID c_OverflowZone = 0;
+
+		struct ProfilerState
+		{
+			std::mutex mutex;
+
+			array<const char*, c_MaxZoneCount> zoneNames = { "Overflow" };
+			std::atomic<size_t> zoneCount = 1;
+
+			// never freed, so the events of a finished thread
+			// can still be read
+			vector<unique_ptr<ProfileRingBuffer>> threadBuffers = {};
+
+			// everything below is only touched by 
+			// the thread that calls Profiler::EndFrame()
+			using FrameTotals = array<uint64_t, c_MaxZoneCount>;
+			array<FrameTotals, c_FrameHistoryLength> frameHistory = {};
+			size_t frameIndex = 0;
+			size_t recordedFrameCount = 0;
+			uint64_t readCount = 0;
+
+			array<ProfileZoneStatistics, c_MaxZoneCount> statistics = {};
+			size_t statisticsCount = 0;
+
+			time_point<high_resolution_clock> start =
+			{
+				high_resolution_clock::now()
+			};
+		};
+
+		ProfilerState& GetState()
+		{
+			static ProfilerState state;
+			return state;
+		}
+	}
+
+	ProfileScope::ProfileScope(const ProfileZoneID zone) :
+		m_Buffer(Profiler::GetThreadBuffer()),
+		m_Zone(zone)
+	{
+		m_Depth = m_Buffer->depth++;
+		m_StartNs = Profiler::GetTimestamp();
+	}
+
+	ProfileScope::~ProfileScope()
+	{
+		const uint64_t endNs = Profiler::GetTimestamp();
+		m_Buffer->depth--;
+
+		const uint64_t writeCount = m_Buffer->writeCount.load();
+		const size_t index = writeCount % ProfileRingBuffer::c_Capacity;
+		m_Buffer->events[index] = { m_StartNs, endNs, m_Zone, m_Depth };
+
+		// publishes the event to anything reading from another thread
+		m_Buffer->writeCount.store(writeCount + 1, std::memory_order_release);
+	}
+
+
+	ProfileZoneID Profiler::RegisterZone(const char* const name)
+	{
+		ProfilerState& state = GetState();
+		const std::lock_guard lock(state.mutex);
+
+		const size_t zoneCount = state.zoneCount.load();
+		if (zoneCount >= c_MaxZoneCount)
+		{
+			const char* const message =
+			{
+				"Profiler::RegisterZone() failed: "
+				"There's no room left for another zone."
+			};
+			Logging::LogWarning(message);
+			return c_OverflowZone;
+		}
+
+		state.zoneNames.at(zoneCount) = name;
+		state.zoneCount.store(zoneCount + 1);
+		return (ProfileZoneID)zoneCount;
+	}
+
+	const char* Profiler::GetZoneName(const ProfileZoneID zone)
+	{
+		const ProfilerState& state = GetState();
+		if (zone >= state.zoneCount.load())
+			return state.zoneNames.at(c_OverflowZone);
+
+		return state.zoneNames.at(zone);
+	}
+
+	uint64_t Profiler::GetTimestamp()
+	{
+		const auto duration = high_resolution_clock::now() - GetState().start;
+		return duration_cast<nanoseconds>(duration).count();
+	}
+
+	ProfileRingBuffer* Profiler::GetThreadBuffer()
+	{
+		thread_local ProfileRingBuffer* buffer = nullptr;
+		if (buffer)
+			return buffer;
+
+		ProfilerState& state = GetState();
+		const std::lock_guard lock(state.mutex);
+
+		state.threadBuffers.push_back(std::make_unique<ProfileRingBuffer>());
+		buffer = state.threadBuffers.back().get();
+		buffer->threadIndex = (uint32_t)(state.threadBuffers.size() - 1);
+		return buffer;
+	}
+
+	vector<const ProfileRingBuffer*> Profiler::GetThreadBuffers()
+	{
+		ProfilerState& state = GetState();
+		const std::lock_guard lock(state.mutex);
+
+		vector<const ProfileRingBuffer*> result = {};
+		result.reserve(state.threadBuffers.size());
+		for (const unique_ptr<ProfileRingBuffer>& buffer : state.threadBuffers)
+			result.push_back(buffer.get());
+
+		return result;
+	}
+
+	void Profiler::EndFrame()
+	{
+		ProfilerState& state = GetState();
+
+		const auto accumulateEvents =
+			[&](ProfilerState::FrameTotals& totals)
+			{
+				const ProfileRingBuffer* const buffer = GetThreadBuffer();
+				const uint64_t writeCount = buffer->writeCount.load();
+
+				// anything older than a full buffer has been overwritten
+				const uint64_t capacity = ProfileRingBuffer::c_Capacity;
+				if ((writeCount - state.readCount) > capacity)
+					state.readCount = writeCount - capacity;
+
+				for (; state.readCount < writeCount; state.readCount++)
+				{
+					const size_t index = state.readCount % capacity;
+					const ProfileEvent& event = buffer->events[index];
+					totals.at(event.zone) += event.endNs - event.startNs;
+				}
+			};
+
+		const auto calculateStatistics =
+			[&]()
+			{
+				constexpr float nsPerMs = 1'000'000;
+
+				const size_t zoneCount = state.zoneCount.load();
+				const size_t frameCount = state.recordedFrameCount;
+
+				for (size_t zone = 0; zone < zoneCount; zone++)
+				{
+					uint64_t sum = 0;
+					uint64_t max = 0;
+					for (size_t frame = 0; frame < frameCount; frame++)
+					{
+						const uint64_t total = state.frameHistory[frame][zone];
+						sum += total;
+						max = std::max(max, total);
+					}
+
+					ProfileZoneStatistics& statistics = state.statistics[zone];
+					statistics.name = state.zoneNames[zone];
+					statistics.average = (sum / (float)frameCount) / nsPerMs;
+					statistics.max = max / nsPerMs;
+				}
+				state.statisticsCount = zoneCount;
+			};
+
+		ProfilerState::FrameTotals& totals =
+		{
+			state.frameHistory.at(state.frameIndex)
+		};
+		totals.fill(0);
+		accumulateEvents(totals);
+
+		state.frameIndex = (state.frameIndex + 1) % c_FrameHistoryLength;
+		state.recordedFrameCount =
+		{
+			std::min(state.recordedFrameCount + 1, c_FrameHistoryLength)
+		};
+		calculateStatistics();
+	}
+
+	std::span<const ProfileZoneStatistics> Profiler::GetStatistics()
+	{
+		const ProfilerState& state = GetState();
+		return { state.statistics.data(), state.statisticsCount };
+	}
+}
\ No newline at end of file
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "Utils.h"
+#include "Debug.h"
+
+#include <atomic>
+#include <span>
+
+#if COMPILE_CONFIG_PROFILING
+#define PROFILE_CONCATENATE_INNER(a, b) a##b
+#define PROFILE_CONCATENATE(a, b) PROFILE_CONCATENATE_INNER(a, b)
+
+// times the rest of the enclosing scope.
+// the zone is only registered the first time this line runs
+#define PROFILE_ZONE(name) \
+	static const BlastOff::ProfileZoneID \
+		PROFILE_CONCATENATE(profileZoneID, __LINE__) = \
+		BlastOff::Profiler::RegisterZone(name); \
+	const BlastOff::ProfileScope PROFILE_CONCATENATE(profileScope, __LINE__) \
+		(PROFILE_CONCATENATE(profileZoneID, __LINE__))
+#else
+#define PROFILE_ZONE(name) ((void)0)
+#endif
+
+namespace BlastOff
+{
+	using ProfileZoneID = uint16_t;
+
+	struct ProfileEvent
+	{
+		uint64_t startNs = 0;
+		uint64_t endNs = 0;
+		ProfileZoneID zone = 0;
+		uint16_t depth = 0;
+	};
+
+	// only ever written by the thread that owns it,
+	// so recording an event never takes a lock or allocates.
+	// once full, the oldest events are overwritten
+	struct ProfileRingBuffer
+	{
+		static constexpr size_t c_Capacity = 1 << 14;
+
+		array<ProfileEvent, c_Capacity> events = {};
+		std::atomic<uint64_t> writeCount = 0;
+		uint16_t depth = 0;
+
+		// in order of creation, starting from zero
+		uint32_t threadIndex = 0;
+	};
+
+	struct ProfileScope
+	{
+		ProfileScope(const ProfileZoneID zone);
+		~ProfileScope();
+
+	private:
+		ProfileRingBuffer* m_Buffer = nullptr;
+		ProfileZoneID m_Zone = 0;
+		uint16_t m_Depth = 0;
+		uint64_t m_StartNs = 0;
+	};
+
+	// in milliseconds per frame
+	struct ProfileZoneStatistics
+	{
+		const char* name = nullptr;
+		float average = 0;
+		float max = 0;
+	};
+
+	struct Profiler
+	{
+		static ProfileZoneID RegisterZone(const char* const name);
+		static const char* GetZoneName(const ProfileZoneID zone);
+
+		// nanoseconds since the profiler started
+		static uint64_t GetTimestamp();
+
+		// created the first time a thread records an event
+		static ProfileRingBuffer* GetThreadBuffer();
+
+		// every buffer created so far.
+		// buffers are never freed, so these stay valid forever
+		static vector<const ProfileRingBuffer*> GetThreadBuffers();
+
+		// folds every event the calling thread recorded since the
+		// previous call into the frame history, then recalculates
+		// the statistics over it
+		static void EndFrame();
+		static std::span<const ProfileZoneStatistics> GetStatistics();
+	};
+}
\ No newline at end of file
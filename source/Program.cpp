@@ -4,17 +4,74 @@
 #include "Graphics.h"
 #include "Logging.h"
 #include "OperatingSystem.h"
+#include "Profiler.h"
 #include "ProgramConstants.h"
 #include "Settings.h"
 #include "Utils.h"
 #include "raylib.h"
 
 #include <chrono>
+#include <future>
 #include <memory>
 
 namespace BlastOff
 {
-	Program::Program()
+	ProgramArguments ProgramArguments::Parse(
+		const int argumentCount,
+		const char* const* const arguments
+	)
+	{
+		ProgramArguments result;
+
+		const auto parseCount =
+			[&](const string& value, optional<uint64_t>& destination)
+			{
+				try
+				{
+					destination = std::stoull(value);
+				}
+				catch (const std::exception& exception)
+				{
+					(void)exception;
+					result.unrecognized.push_back(value);
+				}
+			};
+
+		// the first argument is always the path to the executable
+		for (int index = 1; index < argumentCount; index++)
+		{
+			const string argument = arguments[index];
+			const bool hasValue = (index + 1) < argumentCount;
+
+			if (argument == "--headless")
+				result.isHeadless = true;
+			else if ((argument == "--ticks") && hasValue)
+				parseCount(arguments[++index], result.tickLimit);
+			else if ((argument == "--games") && hasValue)
+				parseCount(arguments[++index], result.gameCount);
+			else if ((argument == "--threads") && hasValue)
+				parseCount(arguments[++index], result.threadCount);
+			else if ((argument == "--seed") && hasValue)
+				parseCount(arguments[++index], result.seed);
+			else if ((argument == "--record") && hasValue)
+				result.recordPath = arguments[++index];
+			else if ((argument == "--replay") && hasValue)
+				result.replayPath = arguments[++index];
+			else if ((argument == "--trace") && hasValue)
+				result.tracePath = arguments[++index];
+			else
+				result.unrecognized.push_back(argument);
+		}
+		return result;
+	}
+
+
+	Program::Program(const ProgramArguments& arguments) :
+		m_Arguments(arguments),
+		m_ImageTextureLoader(&m_AssetManager, arguments.isHeadless),
+		m_SoundLoader(&m_AssetManager, arguments.isHeadless),
+		m_MusicLoader(&m_AssetManager, arguments.isHeadless),
+		m_FrametimeStatistics(c_Config.GetTargetFrametime())
 	{
 		const auto logInitialMessage =
 			[]()
@@ -23,15 +80,109 @@ namespace BlastOff
 				Logging::Log(message);
 			};
 
-		const auto applySettings = 
+		const auto logUnrecognizedArguments =
+			[this]()
+			{
+				for (const string& argument : m_Arguments.unrecognized)
+				{
+					const string message = 
+					{
+						"Ignoring unrecognized argument \"" + argument + "\"."
+					};
+					Logging::Log(message.c_str());
+				}
+			};
+
+		// each one is started before the window and waited on once 
+		// the window is up. none of them touch the window or GL context
+		std::future<unique_ptr<Settings::ParsedFile>> settingsTask = {};
+		std::future<optional<DecodedFont>> fontTask = {};
+		std::future<unique_ptr<MusicLoop>> audioTask = {};
+		std::future<optional<InputRecording>> replayTask = {};
+
+		const auto measurePhase =
+			[this](const char* const name, const auto& work)
+			{
+				const uint64_t start = m_StartupReport.CalculateElapsed();
+				work();
+				m_StartupReport.AddPhase(name, start, false);
+			};
+
+		const auto startTask =
+			[this](const char* const name, const auto& work)
+			{
+				const auto measuredWork =
+					[this, name, work]()
+					{
+						const uint64_t start = 
+						{
+							m_StartupReport.CalculateElapsed()
+						};
+						auto result = work();
+						m_StartupReport.AddPhase(name, start, true);
+						return result;
+					};
+#if COMPILE_TARGET_EMSCRIPTEN
+				// there are no pthreads, so each task runs 
+				// on the main thread once it's waited for
+				constexpr std::launch policy = std::launch::deferred;
+#else
+				constexpr std::launch policy = std::launch::async;
+#endif
+				return std::async(policy, measuredWork);
+			};
+
+		// how long the main thread waits is how long 
+		// the task actually held startup up
+		const auto waitFor =
+			[this](const char* const name, auto& task)
+			{
+				const uint64_t start = m_StartupReport.CalculateElapsed();
+				auto result = task.get();
+				m_StartupReport.AddPhase(name, start, false);
+				return result;
+			};
+
+		const auto initializeTraceWriter =
+			[this]()
+			{
+				if (!m_Arguments.tracePath)
+					return;
+
+#if COMPILE_CONFIG_PROFILING
+				const string& path = *m_Arguments.tracePath;
+				m_TraceWriter = std::make_unique<TraceWriter>(path);
+#else
+				const char* const message =
+				{
+					"Ignoring --trace, since profiling is compiled out."
+				};
+				Logging::Log(message);
+#endif
+			};
+
+		const auto applyHeadlessWindowSize = 
 			[this]()
 			{
+				const Vector2i size = c_Config.CalculateHeadlessWindowSize();
+				m_Window->SetSize(size);
+			};
+
+		const auto applySettings = 
+			[&, this]()
+			{
+				const unique_ptr<Settings::ParsedFile> parsedFile =
+				{
+					waitFor("waiting on settings", settingsTask)
+				};
+
 				const Vector2f aspectRatio = c_Config.GetDefaultAspectRatio();
 				const int windowSizeIncrement = 
 				{
 					c_Config.GetWindowSizeIncrement()
 				};
 				m_Settings = Settings::LoadOrDefault(
+					parsedFile.get(),
 					aspectRatio, 
 					windowSizeIncrement
 				);
@@ -56,6 +207,78 @@ namespace BlastOff
 				EndDrawing();
 			};
 
+		// rasterizing every glyph at the render size is most of
+		// what loading the font costs, and none of it needs the GPU.
+		// cooked fonts are read straight out of the archive
+		const auto decodeFont =
+			[this]() -> optional<DecodedFont>
+			{
+				const string& fontFace = c_Config.GetFontFace();
+				const int fontSize = c_Config.GetFontRenderSize();
+
+				const AssetArchive* const archive =
+				{
+					m_AssetManager.GetArchive()
+				};
+				const optional<ArchivedAsset> asset =
+				{
+					archive ? 
+						archive->Find("ttf/" + fontFace + ".ttf") : 
+						std::nullopt
+				};
+				if (asset)
+				{
+					return TextTextureLoader::DecodeFont(
+						asset->data,
+						(size_t)asset->entry->dataSize,
+						fontSize
+					);
+				}
+
+				const string fontPath = GetFontPath(fontFace.c_str(), "ttf");
+				const unique_ptr<MappedFile> file =
+				{
+					MappedFile::Open(fontPath.c_str())
+				};
+				if (!file)
+					return std::nullopt;
+
+				return TextTextureLoader::DecodeFont(
+					file->GetData(),
+					file->GetSize(),
+					fontSize
+				);
+			};
+
+		const auto loadFont =
+			[&, this](const string& fontPath, const int fontSize) -> Font
+			{
+				const optional<DecodedFont> decoded =
+				{
+					waitFor("waiting on the font", fontTask)
+				};
+
+				// LoadFontEx() logs why, and falls back to raylib's own
+				constexpr int codepointCount = 0;
+				if (!decoded)
+				{
+					return LoadFontEx(
+						fontPath.c_str(), 
+						fontSize, 
+						nullptr, 
+						codepointCount
+					);
+				}
+
+				const uint64_t start = m_StartupReport.CalculateElapsed();
+				const Font result = 
+				{
+					TextTextureLoader::InsertDecodedFont(*decoded)
+				};
+				m_StartupReport.AddPhase("font upload", start, false);
+				return result;
+			};
+
 		const auto initializeGraphics =
 			[&, this]()
 			{
@@ -65,30 +288,55 @@ namespace BlastOff
 				constexpr Vector2i initialWindowSize = { 0, 0 };
 #endif
 				const string windowName = c_Config.CalculateBuildString();
+				const bool isHeadless = m_Arguments.isHeadless;
 
-				m_Window = std::make_unique<RayWindow>(
-					initialWindowSize, 
-					windowName
+				measurePhase(
+					"window",
+					[&, this]()
+					{
+						m_Window = std::make_unique<RayWindow>(
+							initialWindowSize, 
+							windowName,
+							isHeadless
+						);
+					}
 				);
-				applySettings();
-				
-				const int normalFramerate = CalculateNormalFramerate();
-				SetFramerate(normalFramerate);
+				if (isHeadless)
+					applyHeadlessWindowSize();
+				else
+				{
+					applySettings();
+
+					const int normalFramerate = CalculateNormalFramerate();
+					SetFramerate(normalFramerate);
+				}
 
 				const string& fontFace = c_Config.GetFontFace();
 				const string fontPath = GetFontPath(fontFace.c_str(), "ttf");
 				const int fontSize = c_Config.GetFontRenderSize();
 
-				constexpr int codepointCount = 0;
-				m_Font = LoadFontEx(
-					fontPath.c_str(), 
-					fontSize, 
-					nullptr, 
-					codepointCount
-				);
+				if (isHeadless)
+				{
+					m_Font = TextTextureLoader::LoadHeadlessFont(
+						fontPath.c_str(), 
+						fontSize
+					);
+				}
+				else
+				{
+					m_Font = loadFont(fontPath, fontSize);
+
+					// text is drawn straight from the font's atlas,
+					// at every size, so it needs mipmaps to shrink well
+					GenTextureMipmaps(&m_Font.texture);
+					SetTextureFilter(
+						m_Font.texture, 
+						ImageTextureLoader::c_DefaultTextureFiltering
+					);
+				}
 				m_TextTextureLoader = 
 				{
-					std::make_unique<TextTextureLoader>(&m_Font)
+					std::make_unique<TextTextureLoader>(&m_Font, isHeadless)
 				};
 				m_CoordinateTransformer = std::make_unique<CoordinateTransformer>(
                     m_Window->GetSize(),
@@ -98,7 +346,8 @@ namespace BlastOff
 
 				// pause for one frame because of 
 				// some weird bug with Raylib or GLFW
-				pauseForOneFrame();
+				if (!isHeadless)
+					pauseForOneFrame();
 
 				m_Window->Update();
                 m_CoordinateTransformer->Update();
@@ -122,20 +371,16 @@ namespace BlastOff
                 };
             };
 
-		const auto initializeSound =
-			[this]()
-			{
-				const bool isSoundEnabled = c_Config.GetSoundEnabled();
-				if (isSoundEnabled)
-					InitAudioDevice();
-			};
-
-		const auto initializeBackgroundMusic =
-			[this]()
+		// the audio device is separate from the window,
+		// so it comes up alongside it, along with the music
+		const auto initializeAudio =
+			[this]() -> unique_ptr<MusicLoop>
 			{
 				const bool isSoundEnabled = c_Config.GetSoundEnabled();
 				if (!isSoundEnabled)
-					return;
+					return nullptr;
+
+				InitAudioDevice();
 
 				const string& resourcePath =
 				{
@@ -145,15 +390,84 @@ namespace BlastOff
 				const float loopEnd = c_Config.GetBackgroundMusicLoopEnd();
 				const float volume = c_Config.GetBackgroundMusicVolume();
 
-				m_BackgroundMusicLoop = MusicLoop::LoadFromPath(
+				unique_ptr<MusicLoop> result = MusicLoop::LoadFromPath(
 					resourcePath.c_str(),
 					loopStart,
 					loopEnd,
 					&m_MusicLoader
 				);
+				result->SetVolume(volume);
+				return result;
+			};
+
+		const auto loadReplay =
+			[this]() -> optional<InputRecording>
+			{
+				if (!m_Arguments.replayPath)
+					return std::nullopt;
+
+				const string& path = *m_Arguments.replayPath;
+				return InputRecording::LoadFromPath(path.c_str());
+			};
 
-				m_BackgroundMusicLoop->SetVolume(volume);
-				m_BackgroundMusicLoop->Play();
+		const auto startTasks =
+			[&, this]()
+			{
+				settingsTask = startTask(
+					"settings",
+					[]() { return Settings::ParseDefaultFile(); }
+				);
+				fontTask = startTask("font", decodeFont);
+				audioTask = startTask("audio and music", initializeAudio);
+				replayTask = startTask("replay", loadReplay);
+			};
+
+		const auto startBackgroundMusic =
+			[&, this]()
+			{
+				// the music loader isn't thread-safe,
+				// so this has to finish before the preloader starts
+				m_BackgroundMusicLoop = 
+				{
+					waitFor("waiting on audio", audioTask)
+				};
+				if (m_BackgroundMusicLoop)
+					m_BackgroundMusicLoop->Play();
+			};
+
+		// everything is preloaded in the background from the start,
+		// with what the first state needs at the front of the queue
+		const auto initializePreloader =
+			[this](const State firstState)
+			{
+#if COMPILE_TARGET_EMSCRIPTEN
+				// there are no pthreads, so it decodes on the main thread
+				constexpr size_t threadCount = 0;
+#else
+				const size_t threadCount =
+				{
+					std::max(std::thread::hardware_concurrency(), 2u) - 1
+				};
+#endif
+				m_Preloader = std::make_unique<AssetPreloader>(
+					&m_AssetManager,
+					&m_ImageTextureLoader,
+					&m_SoundLoader,
+					&m_MusicLoader,
+					threadCount
+				);
+
+				m_Preloader->EnqueueAtlases();
+				m_Preloader->Enqueue(AssetManifest::ForState(firstState));
+
+				const array<State, 3> states =
+				{
+					State::MainMenu,
+					State::Game,
+					State::SettingsMenu
+				};
+				for (const State state : states)
+					m_Preloader->Enqueue(AssetManifest::ForState(state));
 			};
 
 		const auto disableEscapeKey =
@@ -168,20 +482,70 @@ namespace BlastOff
 
 		Logging::Initialize(&c_Config);
 		logInitialMessage();
+		logUnrecognizedArguments();
+		initializeTraceWriter();
+
+		// before anything loads, so everything can come out of it.
+		// debug builds read the loose files, so an edited resource
+		// shows up without recooking, instead of a stale archived one
+#if !COMPILE_CONFIG_DEBUG
+		measurePhase(
+			"archive",
+			[this]()
+			{
+				m_AssetManager.OpenArchive(AssetArchive::c_DefaultPath);
+			}
+		);
+#endif
+		if (m_Arguments.isHeadless)
+		{
+			initializeGraphics();
+			InitializeCutscene();
+			return;
+		}
 
+		startTasks();
 		initializeGraphics();
 		initializeInput();
-		initializeSound();
-		initializeBackgroundMusic();
+		startBackgroundMusic();
 		disableEscapeKey();
-		InitializeMainMenu();
-		InitializeCutscene();
-
-		m_State = State::MainMenu;
+		m_Replay = waitFor("waiting on the replay", replayTask);
+
+		// the menus and the game are built once what they need is in,
+		// so constructing them never loads anything itself
+		const State firstState = m_Replay ? State::Game : State::MainMenu;
+		measurePhase(
+			"preloader",
+			[&]() { initializePreloader(firstState); }
+		);
+		measurePhase("first state", [&, this]() { EnterState(firstState); });
 	}
 
 	Program::~Program()
 	{
+		const auto logFrametimeStatistics =
+			[this]()
+			{
+				const FrametimeReport report =
+				{
+					m_FrametimeStatistics.CalculateSessionReport()
+				};
+				if (!report.frameCount)
+					return;
+
+				Logging::Log("Frametime statistics:");
+				for (const string& line : FrametimeStatistics::FormatReport(report))
+					Logging::Log(line.c_str());
+			};
+
+		const auto logAssetReport =
+			[this]()
+			{
+				Logging::Log("Asset report:");
+				for (const string& line : m_AssetManager.FormatReport())
+					Logging::Log(line.c_str());
+			};
+
 		const auto writeSettingsFile = 
 			[this]()
 			{
@@ -191,13 +555,19 @@ namespace BlastOff
 				m_Settings->SaveToDefaultPath();
 			};
 
+		logFrametimeStatistics();
+		logAssetReport();
+
 		if (IsAudioDeviceReady())
 			CloseAudioDevice();
 
 		if (m_Font.texture.id)
 			UnloadFont(m_Font);
+		else
+			TextTextureLoader::UnloadHeadlessFont(m_Font);
 
-		writeSettingsFile();
+		if (!m_Arguments.isHeadless)
+			writeSettingsFile();
 	}
 
 	bool Program::IsRunning() const
@@ -207,13 +577,75 @@ namespace BlastOff
 
 	void Program::RunLoopIteration()
 	{
-		Update();
-		Draw();
+		const auto measure =
+			[](const auto& work) -> uint64_t
+			{
+				const auto start = high_resolution_clock::now();
+				work();
+
+				const auto duration = high_resolution_clock::now() - start;
+				return duration_cast<nanoseconds>(duration).count();
+			};
+
+		const auto recordFrame =
+			[this](FrameSample sample)
+			{
+				const auto end = high_resolution_clock::now();
+				const auto duration = end - m_FrameStartTime;
+				m_FrameStartTime = end;
+
+				sample.frame = duration_cast<nanoseconds>(duration).count();
+				m_FrametimeStatistics.AddFrame(sample);
+			};
+
+		// logged once, at the first frame past the loading screen
+		const auto updateStartupReport =
+			[this]()
+			{
+				if (m_StartupReport.IsComplete())
+					return;
+
+				m_StartupReport.MarkFrame(m_State != State::Loading);
+				if (!m_StartupReport.IsComplete())
+					return;
+
+				Logging::Log("Startup report:");
+				for (const string& line : m_StartupReport.FormatReport())
+					Logging::Log(line.c_str());
+			};
+
+		// the first frame would otherwise be timed from startup
+		if (!m_TickCount)
+			m_FrameStartTime = high_resolution_clock::now();
+
+		FrameSample sample = {};
+		sample.state = m_State;
+
+		if (m_Arguments.isHeadless)
+			sample.update = measure([this]() { UpdateHeadless(); });
+		else
+		{
+			sample.update = measure([this]() { Update(); });
+			sample.draw = measure([this]() { Draw(); });
+
+			// waits out the rest of the frame, 
+			// so it's left out of the draw time
+			PROFILE_ZONE("EndDrawing");
+			EndDrawing();
+		}
 		EndFrame();
+		recordFrame(sample);
+		updateStartupReport();
+
+#if COMPILE_CONFIG_PROFILING
+		Profiler::EndFrame();
+#endif
 	}
 
 	void Program::Update()
 	{
+		PROFILE_ZONE("Program::Update");
+
 		const auto updateControlQ =
 			[this]()
 			{
@@ -238,6 +670,10 @@ namespace BlastOff
 						m_SettingsMenu->Update();
 						break;
 
+					case State::Loading:
+						UpdateLoading();
+						break;
+
 					default:
 					{
 						const char* const message = 
@@ -304,8 +740,16 @@ namespace BlastOff
 		m_CoordinateTransformer->Update();
 		m_Window->Update();
 
+		// the loading screen finishes its own, with a bigger budget
+		const float preloadBudget = c_Config.GetPreloadFrameBudget();
+		if (m_State != State::Loading)
+			m_Preloader->Update(preloadBudget);
+
 		if (ShouldShowCutscene())
 			m_Cutscene->Update();
+
+		// after the cutscene, since it moves the camera
+		m_InputManager->Update();
 		
 		updateStateObject();
 		m_CameraEmpty->Update();
@@ -321,29 +765,58 @@ namespace BlastOff
 		m_Settings->ApplyVolume();
 		updateMutedField();
 
+		// anything loaded lazily from here on was missed by a manifest
+		if (m_Preloader->CalculateProgress() >= 1)
+			m_AssetManager.SetLazyLoadsExpected(false);
+
+#if COMPILE_CONFIG_PROFILING
+		const int profilerOverlayKey = c_Config.GetProfilerOverlayKey();
+		if (IsKeyPressed(profilerOverlayKey))
+			m_ProfilerOverlayShown = !m_ProfilerOverlayShown;
+#endif
+
 #if COMPILE_CONFIG_DEBUG
 		if (c_Config.GetDebugToolsEnabled())
 			updateSpeedKeys();
 #endif
 	}
 
-	void Program::Draw() const
+	void Program::UpdateHeadless()
 	{
+		PROFILE_ZONE("Program::UpdateHeadless");
+
+		m_CoordinateTransformer->Update();
+		m_Cutscene->Update();
+		m_CameraEmpty->Update();
+	}
+
+	void Program::Draw()
+	{
+		PROFILE_ZONE("Program::Draw");
+
+		RenderQueue* const renderQueue = &m_RenderQueue;
+
 		const auto drawStateObject = 
-			[this]()
+			[&, this]()
 			{
 				switch (m_State)
 				{
 					case State::Game:
-						m_Game->Draw();
+						m_Game->Draw(renderQueue);
 						break;
 
 					case State::MainMenu:
-						m_MainMenu->Draw();
+						renderQueue->SetLayer(RenderLayer::Menus);
+						m_MainMenu->Draw(renderQueue);
 						break;
 
 					case State::SettingsMenu:
-						m_SettingsMenu->Draw();
+						renderQueue->SetLayer(RenderLayer::Menus);
+						m_SettingsMenu->Draw(renderQueue);
+						break;
+
+					case State::Loading:
+						DrawLoadingScreen();
 						break;
 
 					default:
@@ -364,71 +837,32 @@ namespace BlastOff
 		ClearBackground(voidColour.ToRayColour());
 
 		if (ShouldShowCutscene())
-			m_Cutscene->Draw();
+			m_Cutscene->Draw(renderQueue);
 
 		drawStateObject();
+		renderQueue->Flush();
 		
 		if (c_DrawFPS)
 			DrawFramerate();
-			
-		EndDrawing();
+
+#if COMPILE_CONFIG_PROFILING
+		if (m_ProfilerOverlayShown)
+			DrawProfilerOverlay();
+#endif
 	}
 
 	void Program::EndFrame()
 	{
-		const auto reinitializeRelevantObject = 
-			[&, this](const State state)
-			{
-				switch (state)
-				{
-					case State::Game:
-						InitializeGame();
-						break;
-
-					case State::MainMenu:
-						InitializeMainMenu();
-						break;
-
-					case State::SettingsMenu:
-						InitializeSettingsMenu();
-						break;
-
-					default:
-						const char* const message =
-						{
-							"Program::Update() failed: "
-							"Invalid value of ProgramState enum."
-						};
-						Logging::LogWarning(message);
-				}
-			};
+		PROFILE_ZONE("Program::EndFrame");
 
 		const auto handleStateChange = 
 			[&, this]()
 			{
-				reinitializeRelevantObject(*m_PendingStateChange);
-				
-				m_State = *m_PendingStateChange;
+				PROFILE_ZONE("Program::EndFrame state change");
+				const State state = *m_PendingStateChange;
 				m_PendingStateChange = std::nullopt;
-			};
-
-		const auto calculateFrametimeStatistics = 
-			[this]()
-			{
-				if (!c_PrintFrametimes)
-					return;
-
-				const auto end = high_resolution_clock::now();
-				const auto duration = end - m_FrameStartTime;
-				m_FrameStartTime = high_resolution_clock::now();
 
-				const auto ns = duration_cast<nanoseconds>(duration).count();
-				const float secs = ns / powf(10, 9);
-				const float ratio = c_Config.GetTargetFrametime() / secs;
-
-				std::printf("frametime: %f ms\n", secs * 1'000.0f);
-				std::printf("ratio: %fx\n", ratio);
-				std::printf("\n");
+				EnterState(state);
 			};
 
 		if (m_PendingStateChange)
@@ -437,21 +871,25 @@ namespace BlastOff
 		if (m_ShouldCloseAfterFrame)
 			m_IsRunning = false;
 
+		// reset in place, since rebuilding every object
+		// made the first frame of each new game a hitch
 		if (m_GameShouldReset)
 		{
-			InitializeGame();
+			m_Game->Reset(ChooseGameSeed());
 			m_GameShouldReset = false;
 		}
         if (m_CutsceneShouldReset)
         {
-            InitializeCutscene();
+            m_Cutscene->Reset(RandomStreams::GenerateSeed());
             m_CutsceneShouldReset = false;
         }
 
-		if (WindowShouldClose())
+		if ((!m_Arguments.isHeadless) && WindowShouldClose())
 			m_IsRunning = false;
 
-		calculateFrametimeStatistics();
+		m_TickCount++;
+		if (m_Arguments.tickLimit && (m_TickCount >= *m_Arguments.tickLimit))
+			m_IsRunning = false;
 	}
 
 	bool Program::ShouldShowCutscene() const
@@ -498,6 +936,73 @@ namespace BlastOff
 #endif
 	}
 
+	void Program::UpdateLoading()
+	{
+		PROFILE_ZONE("Program::UpdateLoading");
+
+		const float budget = c_Config.GetLoadingFrameBudget();
+		m_Preloader->Update(budget);
+
+		const AssetManifest manifest = AssetManifest::ForState(m_LoadingTarget);
+		if (m_Preloader->IsResident(manifest))
+			m_PendingStateChange = m_LoadingTarget;
+	}
+
+	void Program::DrawLoadingScreen() const
+	{
+		if (!c_Config.GetLoadingScreenShown())
+			return;
+
+		const Vector2i windowSize = *m_Window->GetSize();
+		const Vector2f barSize = 
+		{
+			windowSize.x * 2 / 3.0f,
+			windowSize.x / 24.0f
+		};
+		const Vector2f barPosition = (windowSize - barSize) / 2.0f;
+		const float progress = m_Preloader->CalculateProgress();
+
+		constexpr RayColour colour = c_White.ToRayColour();
+		const float outlineThickness = barSize.y / 8.0f;
+		const RayRect2f outline = 
+		{
+			barPosition.x, 
+			barPosition.y, 
+			barSize.x, 
+			barSize.y
+		};
+		const RayRect2f fill =
+		{
+			barPosition.x,
+			barPosition.y,
+			barSize.x * progress,
+			barSize.y
+		};
+		DrawRectangleLinesEx(outline, outlineThickness, colour);
+		DrawRectangleRec(fill, colour);
+
+		const string text = std::format("Loading {}%", (int)(progress * 100));
+		const float fontSize = barSize.y;
+		const float spacing = fontSize / 10.0f;
+		const Vector2f textSize = 
+		{
+			MeasureTextEx(m_Font, text.c_str(), fontSize, spacing)
+		};
+		const RayVector2f textPosition =
+		{
+			(windowSize.x - textSize.x) / 2.0f,
+			barPosition.y - (textSize.y * 3 / 2.0f)
+		};
+		DrawTextEx(
+			m_Font, 
+			text.c_str(), 
+			textPosition, 
+			fontSize, 
+			spacing, 
+			colour
+		);
+	}
+
 	void Program::DrawFramerate()
 	{
 		const int fps = GetFPS();
@@ -509,8 +1014,152 @@ namespace BlastOff
 		DrawText(text.c_str(), position.x, position.y, 40, colour);
 	}
 
+#if COMPILE_CONFIG_PROFILING
+	void Program::DrawProfilerOverlay() const
+	{
+		// sits just below the framerate
+		constexpr int fontSize = 20;
+		constexpr int lineHeight = 24;
+		constexpr RayColour colour = c_Black.ToRayColour();
+
+		Vector2i position = { 0, 40 };
+
+		// the last few seconds of frames come first
+		const FrametimeReport report =
+		{
+			m_FrametimeStatistics.CalculateRecentReport()
+		};
+		for (const string& line : FrametimeStatistics::FormatReport(report))
+		{
+			DrawText(line.c_str(), position.x, position.y, fontSize, colour);
+			position.y += lineHeight;
+		}
+
+		const RenderStatistics& rendering = m_RenderQueue.GetStatistics();
+		const string renderingText = std::format(
+			"{} draws in {} batches",
+			rendering.commandCount,
+			rendering.batchCount
+		);
+		DrawText(
+			renderingText.c_str(), 
+			position.x, 
+			position.y, 
+			fontSize, 
+			colour
+		);
+		position.y += lineHeight;
+
+		if ((m_State == State::Game) && m_Game)
+		{
+			const CullingStatistics& culling = m_Game->GetCullingStatistics();
+			const string cullingText = std::format(
+				"{} objects drawn, {} culled",
+				culling.drawnCount,
+				culling.culledCount
+			);
+			DrawText(
+				cullingText.c_str(), 
+				position.x, 
+				position.y, 
+				fontSize, 
+				colour
+			);
+			position.y += lineHeight;
+		}
+
+		const string startupText = std::format(
+			"started in {:.0f} ms, interactive in {:.0f} ms",
+			m_StartupReport.CalculateTimeToFirstFrame(),
+			m_StartupReport.CalculateTimeToInteractive()
+		);
+		DrawText(startupText.c_str(), position.x, position.y, fontSize, colour);
+		position.y += lineHeight;
+
+		const string assetText = std::format(
+			"{} assets, {:.1f} MiB",
+			m_AssetManager.CalculateResidentCount(),
+			m_AssetManager.CalculateResidentBytes() / (1024.0f * 1024.0f)
+		);
+		DrawText(assetText.c_str(), position.x, position.y, fontSize, colour);
+		position.y += lineHeight * 2;
+
+		for (const ProfileZoneStatistics& zone : Profiler::GetStatistics())
+		{
+			// skip anything that hasn't run recently
+			if (zone.max == 0)
+				continue;
+
+			const string text = std::format(
+				"{}: {:.3f} ms avg, {:.3f} ms max",
+				zone.name,
+				zone.average,
+				zone.max
+			);
+			DrawText(text.c_str(), position.x, position.y, fontSize, colour);
+			position.y += lineHeight;
+		}
+	}
+#endif
+
+	void Program::EnterState(const State state)
+	{
+		const AssetManifest manifest = AssetManifest::ForState(state);
+		if (m_Preloader && !m_Preloader->IsResident(manifest))
+		{
+			m_LoadingTarget = state;
+			m_State = State::Loading;
+			return;
+		}
+		InitializeState(state);
+	}
+
+	void Program::InitializeState(const State state)
+	{
+		PROFILE_ZONE("Program::InitializeState");
+
+		// built the first time either menu is entered,
+		// since it plays behind them
+		const bool isMenu = 
+		{
+			(state == State::MainMenu) || 
+			(state == State::SettingsMenu)
+		};
+		if (isMenu && !m_Cutscene)
+			InitializeCutscene();
+
+		switch (state)
+		{
+			case State::Game:
+				InitializeGame();
+				break;
+
+			case State::MainMenu:
+				InitializeMainMenu();
+				break;
+
+			case State::SettingsMenu:
+				InitializeSettingsMenu();
+				break;
+
+			default:
+			{
+				const char* const message =
+				{
+					"Program::InitializeState() failed: "
+					"Invalid value of ProgramState enum."
+				};
+				Logging::LogWarning(message);
+				return;
+			}
+		}
+		m_State = state;
+	}
+
 	void Program::InitializeGame()
 	{
+		PROFILE_ZONE("Program::InitializeGame");
+
 		const auto resetCallback =
 			[this]()
 			{
@@ -529,6 +1178,13 @@ namespace BlastOff
 				m_PendingStateChange = State::MainMenu;
 			};
 
+		const uint64_t seed = ChooseGameSeed();
+		const auto inputManagerFactory =
+			[this, seed](const CoordinateTransformer* const coordTransformer)
+			{
+				return CreateGameInputManager(coordTransformer, seed);
+			};
+
 		m_Game = std::make_unique<PlayableGame>(
             &m_IsMuted,
 			&c_Config,
@@ -539,12 +1195,45 @@ namespace BlastOff
 			resetCallback,
 			exitCallback,
 			m_Window->GetPosition(),
-			m_Window->GetSize()
+			m_Window->GetSize(),
+			inputManagerFactory,
+			GamePopulation::Default(),
+			seed
+		);
+	}
+
+	unique_ptr<InputManager> Program::CreateGameInputManager(
+		const CoordinateTransformer* const coordTransformer,
+		const uint64_t seed
+	) const
+	{
+		if (m_Replay)
+		{
+			return std::make_unique<ReplayInputManager>(
+				coordTransformer, 
+				&(*m_Replay)
+			);
+		}
+
+		unique_ptr<InputManager> playableInputManager = 
+		{
+			std::make_unique<PlayableInputManager>(coordTransformer)
+		};
+		if (!m_Arguments.recordPath)
+			return playableInputManager;
+
+		return std::make_unique<RecordingInputManager>(
+			coordTransformer,
+			std::move(playableInputManager),
+			seed,
+			*m_Arguments.recordPath
 		);
 	}
 
 	void Program::InitializeMainMenu()
 	{
+		PROFILE_ZONE("Program::InitializeMainMenu");
+
 		const auto settingsCallback = 
 			[this]()
 			{
@@ -578,8 +1267,16 @@ namespace BlastOff
 		);
 	}
 
+	// a replay always plays the game it recorded
+	uint64_t Program::ChooseGameSeed() const
+	{
+		return m_Replay ? m_Replay->seed : RandomStreams::GenerateSeed();
+	}
+
     void Program::InitializeCutscene()
     {
+        PROFILE_ZONE("Program::InitializeCutscene");
+
         const auto resetCallback = 
             [this]()
             {
@@ -593,12 +1290,17 @@ namespace BlastOff
             &m_ImageTextureLoader,
             m_TextTextureLoader.get(),
             &m_CameraPosition,
-            resetCallback
+            &m_CutsceneStatistics,
+            resetCallback,
+            GamePopulation::Default(),
+            RandomStreams::GenerateSeed()
         );       
     }
 
 	void Program::InitializeSettingsMenu()
 	{
+		PROFILE_ZONE("Program::InitializeSettingsMenu");
+
 		const auto exitCallback = 
 			[this]()
 			{
@@ -627,7 +1329,6 @@ namespace BlastOff
 	}
 
 	const bool Program::c_DrawFPS = false;
-	const bool Program::c_PrintFrametimes = false;
 
 #if COMPILE_CONFIG_DEBUG
 	const bool Program::c_SpeedupInverted = false;
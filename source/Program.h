@@ -8,15 +8,49 @@
 #include "Graphics.h"
 #include "Game.h"
 #include "Sound.h"
+#include "AssetPreloader.h"
 #include "Enums.h"
 #include "Settings.h"
+#include "FrametimeStatistics.h"
+#include "StartupReport.h"
+#include "TraceWriter.h"
 #include <chrono>
 
 namespace BlastOff
 {
+	struct ProgramArguments
+	{
+		// a headless program never opens a window or an audio device.
+		// it only simulates the cutscene, as fast as the CPU allows
+		bool isHeadless = false;
+		optional<uint64_t> tickLimit = std::nullopt;
+
+		// if a game count is given, 
+		// a headless batch of that many games runs instead of the program
+		optional<uint64_t> gameCount = std::nullopt;
+		optional<uint64_t> threadCount = std::nullopt;
+		optional<uint64_t> seed = std::nullopt;
+
+		// every game played is recorded to this path, overwriting
+		// the previous one. a replay skips straight to the game,
+		// and plays it out exactly as it was recorded
+		optional<string> recordPath = std::nullopt;
+		optional<string> replayPath = std::nullopt;
+
+		// streams every profiling zone to a Chrome trace-event file
+		optional<string> tracePath = std::nullopt;
+
+		vector<string> unrecognized = {};
+
+		static ProgramArguments Parse(
+			const int argumentCount, 
+			const char* const* const arguments
+		);
+	};
+
 	struct Program
 	{
-		Program();
+		Program(const ProgramArguments& arguments);
 		~Program();
 
 		void RunLoopIteration();
@@ -27,7 +61,10 @@ namespace BlastOff
 
 		void EndFrame();
 		void Update();
-		void Draw() const;
+		void UpdateHeadless();
+		void UpdateLoading();
+		void Draw();
+		void DrawLoadingScreen() const;
 
 		bool ShouldShowCutscene() const;
 		void MuteOrUnmute();
@@ -36,8 +73,21 @@ namespace BlastOff
 		int MultiplyFramerate(const float multiplier) const;
 		void SetFramerate(const int framerate);
 		static void DrawFramerate();
+#if COMPILE_CONFIG_PROFILING
+		void DrawProfilerOverlay() const;
+#endif
+
+		// goes through the loading screen first,
+		// if anything the state needs isn't resident yet
+		void EnterState(const State state);
+		void InitializeState(const State state);
 
 		void InitializeGame();
+		unique_ptr<InputManager> CreateGameInputManager(
+			const CoordinateTransformer* const coordTransformer,
+			const uint64_t seed
+		) const;
+		uint64_t ChooseGameSeed() const;
 		void InitializeMainMenu();
 		void InitializeCutscene();
 		void InitializeSettingsMenu();
@@ -45,29 +95,50 @@ namespace BlastOff
 		static const inline ProgramConstants c_Config;
 
 		static const bool c_DrawFPS;
-		static const bool c_PrintFrametimes;
 
 #if COMPILE_CONFIG_DEBUG
 		static const bool c_SpeedupInverted;
 #endif
 
+		// declared first, so its clock starts before anything else
+		StartupReport m_StartupReport = {};
+
+		const ProgramArguments m_Arguments;
+
+#if COMPILE_CONFIG_PROFILING
+		// declared early, so it outlives everything it might trace
+		unique_ptr<TraceWriter> m_TraceWriter = nullptr;
+#endif
+		uint64_t m_TickCount = 0;
+
 		bool m_IsRunning = true;
 		bool m_ShouldCloseAfterFrame = false;
         bool m_IsMuted = false;
 		bool m_GameShouldReset = false;
         bool m_CutsceneShouldReset = false;
+#if COMPILE_CONFIG_PROFILING
+		bool m_ProfilerOverlayShown = false;
+#endif
 		
 		unique_ptr<RayWindow> m_Window = nullptr;
 
 		Font m_Font = { 0 };
 		State m_State = State::None;
 		optional<State> m_PendingStateChange = std::nullopt;
+
+		// what the loading screen is waiting to enter
+		State m_LoadingTarget = State::None;
         Vector2f m_CameraPosition = Vector2f::Zero();
 
+		// declared first, so it outlives every loader
+		AssetManager m_AssetManager = {};
 		ImageTextureLoader m_ImageTextureLoader;
 		SoundLoader m_SoundLoader;
 		MusicLoader m_MusicLoader;
 
+		// declared after the loaders, so its workers stop first
+		unique_ptr<AssetPreloader> m_Preloader = nullptr;
+
 		unique_ptr<Settings> m_Settings = nullptr;
 		unique_ptr<TextTextureLoader> m_TextTextureLoader = nullptr;
         unique_ptr<CoordinateTransformer> m_CoordinateTransformer = nullptr;
@@ -76,9 +147,15 @@ namespace BlastOff
 		unique_ptr<MusicLoop> m_BackgroundMusicLoop = nullptr;
 		unique_ptr<Game> m_Game = nullptr;
         unique_ptr<Cutscene> m_Cutscene = nullptr;
+		OutcomeStatistics m_CutsceneStatistics = {};
+		optional<InputRecording> m_Replay = std::nullopt;
 		unique_ptr<MainMenu> m_MainMenu = nullptr;
 		unique_ptr<SettingsMenu> m_SettingsMenu = nullptr;
 
+		// refilled and flushed every frame
+		RenderQueue m_RenderQueue = {};
+
+		FrametimeStatistics m_FrametimeStatistics;
 		time_point<high_resolution_clock> m_FrameStartTime = high_resolution_clock::now();
 
 #if COMPILE_CONFIG_DEBUG
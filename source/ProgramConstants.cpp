@@ -7,9 +7,12 @@ namespace BlastOff
 		m_EscapeKeyEnabled(false),
 		m_CommandLineLoggingEnabled(true),
 		m_ControlQEnabled(true),
+		m_LoadingScreenShown(true),
 		m_TargetFramerate(60),
 		m_WindowSizeIncrement(60),
 		m_TargetFrametime(1 / (float)m_TargetFramerate),
+		m_PreloadFrameBudget(2 / 1000.0f),
+		m_LoadingFrameBudget(m_TargetFrametime * 3 / 4.0f),
 		m_InvalidColour1(0xFF, 0x00, 0xFF),
 		m_InvalidColour2(c_Black),
 		m_VoidColour(c_Black),
@@ -18,6 +21,7 @@ namespace BlastOff
 		m_FontFace("Ubuntu-Medium"),
 		m_FontRenderSize(192),
 		m_DefaultAspectRatio(9, 16),
+		m_HeadlessWindowHeight(960),
 		m_Name("BlastOff++"),
 		m_Version("alpha 1.0.0"),
 		m_BackgroundMusicPath("rifftastic.ogg"),
@@ -25,6 +29,10 @@ namespace BlastOff
 		m_BackgroundMusicLoopEnd(141.3f),
 		m_BackgroundMusicVolume(1 / 4.0f)
 	{
+#if COMPILE_CONFIG_PROFILING
+			m_ProfilerOverlayKey = KEY_F3;
+#endif
+
 #if COMPILE_CONFIG_DEBUG
 			m_DebugToolsEnabled = true;
 
@@ -57,6 +65,11 @@ namespace BlastOff
 		return m_ControlQEnabled;
 	}
 
+	bool ProgramConstants::GetLoadingScreenShown() const
+	{
+		return m_LoadingScreenShown;
+	}
+
 	int ProgramConstants::GetTargetFramerate() const
 	{
 		return m_TargetFramerate;
@@ -72,6 +85,16 @@ namespace BlastOff
 		return m_TargetFrametime;
 	}
 
+	float ProgramConstants::GetPreloadFrameBudget() const
+	{
+		return m_PreloadFrameBudget;
+	}
+
+	float ProgramConstants::GetLoadingFrameBudget() const
+	{
+		return m_LoadingFrameBudget;
+	}
+
 	float ProgramConstants::GetSecondsBetweenSceneChange() const
 	{
 		return m_SecondsBetweenSceneChange;
@@ -112,6 +135,20 @@ namespace BlastOff
 		return m_DefaultAspectRatio;
 	}
 
+	int ProgramConstants::GetHeadlessWindowHeight() const
+	{
+		return m_HeadlessWindowHeight;
+	}
+
+	Vector2i ProgramConstants::CalculateHeadlessWindowSize() const
+	{
+		const Vector2f aspectRatio = m_DefaultAspectRatio;
+		const int height = m_HeadlessWindowHeight;
+		const float width = height * aspectRatio.x / aspectRatio.y;
+
+		return { (int)roundf(width), height };
+	}
+
 	const string& ProgramConstants::GetName() const
 	{
 		return m_Name;
@@ -147,6 +184,13 @@ namespace BlastOff
 		return m_BackgroundMusicVolume;
 	}
 
+#if COMPILE_CONFIG_PROFILING
+	int ProgramConstants::GetProfilerOverlayKey() const
+	{
+		return m_ProfilerOverlayKey;
+	}
+#endif
+
 #if COMPILE_CONFIG_DEBUG
 	bool ProgramConstants::GetDebugToolsEnabled() const
 	{
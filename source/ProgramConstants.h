@@ -14,6 +14,7 @@ namespace BlastOff
 		bool GetEscapeKeyEnabled() const;
 		bool GetCommandLineLoggingEnabled() const;
 		bool GetControlQEnabled() const;
+		bool GetLoadingScreenShown() const;
 
 		int GetTargetFramerate() const;
 		int GetWindowSizeIncrement() const;
@@ -21,6 +22,11 @@ namespace BlastOff
 		float GetTargetFrametime() const;
 		float GetSecondsBetweenSceneChange() const;
 
+		// in seconds, spent each frame finishing preloaded assets.
+		// the loading screen has nothing else to do, so it gets more
+		float GetPreloadFrameBudget() const;
+		float GetLoadingFrameBudget() const;
+
 		Colour4i GetInvalidColour1() const;
 		Colour4i GetInvalidColour2() const;
 		Colour4i GetVoidColour() const;
@@ -30,6 +36,8 @@ namespace BlastOff
 		int GetFontRenderSize() const;
 
 		Vector2f GetDefaultAspectRatio() const;
+		int GetHeadlessWindowHeight() const;
+		Vector2i CalculateHeadlessWindowSize() const;
 
 		const string& GetName() const;
 		const string& GetVersion() const;
@@ -41,6 +49,10 @@ namespace BlastOff
 		float GetBackgroundMusicLoopEnd() const;
 		float GetBackgroundMusicVolume() const;
 
+#if COMPILE_CONFIG_PROFILING
+		int GetProfilerOverlayKey() const;
+#endif
+
 #if COMPILE_CONFIG_DEBUG
 		bool GetDebugToolsEnabled() const;
 
@@ -56,10 +68,13 @@ namespace BlastOff
 		bool m_EscapeKeyEnabled;
 		bool m_CommandLineLoggingEnabled;
 		bool m_ControlQEnabled;
+		bool m_LoadingScreenShown;
 
 		int m_TargetFramerate;
 		int m_WindowSizeIncrement;
 		float m_TargetFrametime;
+		float m_PreloadFrameBudget;
+		float m_LoadingFrameBudget;
 
 		Colour4i m_InvalidColour1;
 		Colour4i m_InvalidColour2;
@@ -72,6 +87,7 @@ namespace BlastOff
 		int m_FontRenderSize;
 
 		Vector2f m_DefaultAspectRatio;
+		int m_HeadlessWindowHeight;
 
 		string m_Name;
 		string m_Version;
@@ -81,6 +97,10 @@ namespace BlastOff
 		float m_BackgroundMusicLoopEnd;
 		float m_BackgroundMusicVolume;
 
+#if COMPILE_CONFIG_PROFILING
+		int m_ProfilerOverlayKey = 0;
+#endif
+
 #if COMPILE_CONFIG_DEBUG
 		bool m_DebugToolsEnabled;
 
@@ -2,6 +2,7 @@
 #include "Graphics.h"
 #include "OperatingSystem.h"
 #include "Logging.h"
+#include "Profiler.h"
 #include "Utils.h"
 #include "raylib.h"
 #include <memory>
@@ -9,9 +10,9 @@
 
 namespace BlastOff
 {
-	float SpawningRange::ChooseYPosition() const
+	float SpawningRange::ChooseYPosition(RandomStream* const random) const
 	{
-		const float num = GetRandomFloat();
+		const float num = random->NextFloat();
 
 		const float start = bottom;
 		const float end = top;
@@ -49,9 +50,17 @@ namespace BlastOff
 		m_Sprite->SetEngineRect(engineRect);
 	}
 
-	void Crag::Draw() const
+	void Crag::Draw(RenderQueue* const renderQueue) const
 	{
-		m_Sprite->Draw();
+		m_Sprite->Draw(renderQueue);
+	}
+
+	vector<string> Crag::GetTexturePaths()
+	{
+		return
+		{
+			c_TexturePath
+		};
 	}
 
 	const char* const Crag::c_TexturePath = "props/crag.png";
@@ -118,9 +127,17 @@ namespace BlastOff
 		return m_Sprite->GetRightCollisionLine();
 	}
 
-	void SpawnPlatform::Draw() const
+	void SpawnPlatform::Draw(RenderQueue* const renderQueue) const
+	{
+		m_Sprite->Draw(renderQueue);
+	}
+
+	vector<string> SpawnPlatform::GetTexturePaths()
 	{
-		m_Sprite->Draw();
+		return
+		{
+			c_TexturePath
+		};
 	}
 
 	const char* const SpawnPlatform::c_TexturePath = "props/spawnPlatform.png";
@@ -135,33 +152,17 @@ namespace BlastOff
 		ImageTextureLoader* const imageTextureLoader
 	)
 	{
-		const auto calculateEngineRect =
-			[&, this](const Texture* texture) -> Rect2f
-			{
-				const float aspectRatio = texture->width / (float)texture->height;
-				const Vector2f engineSize = 
-				{ 
-					aspectRatio * c_EngineHeight, 
-					c_EngineHeight 
-				};
-				const float perSegment = c_XOffsetPerSegment;
-				const float fromLeft = segmentIndex * perSegment;
-				const float overhang = engineSize.x - perSegment;
-				const float totalWidth = 
-				{
-					((amountOfSegments - 1) * perSegment) + (overhang / 2.0f)
-				};
-				const float left = -totalWidth / 2.0f;
-				const float xPosition = left + fromLeft;
-				return Rect2f({ xPosition, 0 }, engineSize);
-			};	
-
-		const Texture* texture = 
+		const TextureRegion* texture = 
 		{
 			imageTextureLoader->LazyLoadTexture(c_TexturePath)
 		};
+		const Rect2f engineRect = CalculateEngineRect(
+			{ texture->width, texture->height },
+			segmentIndex,
+			amountOfSegments
+		);
 		m_Sprite = std::make_unique<ImageSprite>(
-			calculateEngineRect(texture),
+			engineRect,
 			coordTransformer,
 			programConstants,
 			texture
@@ -179,14 +180,57 @@ namespace BlastOff
 		return m_Sprite->CalculateRealRect();
 	}
 
+	void FloatingPlatformSegment::Arrange
+		(const size_t segmentIndex, const size_t amountOfSegments)
+	{
+		const Rect2f engineRect = CalculateEngineRect(
+			m_Sprite->GetImageSize(),
+			segmentIndex,
+			amountOfSegments
+		);
+		m_Sprite->SetEngineRect(engineRect);
+	}
+
 	void FloatingPlatformSegment::Update()
 	{
 		m_Sprite->Update();
 	}
 
-	void FloatingPlatformSegment::Draw() const
+	void FloatingPlatformSegment::Draw(RenderQueue* const renderQueue) const
+	{
+		m_Sprite->Draw(renderQueue);
+	}
+
+	Rect2f FloatingPlatformSegment::CalculateEngineRect(
+		const Vector2i imageSize,
+		const size_t segmentIndex,
+		const size_t amountOfSegments
+	)
 	{
-		m_Sprite->Draw();
+		const float aspectRatio = imageSize.x / (float)imageSize.y;
+		const Vector2f engineSize = 
+		{ 
+			aspectRatio * c_EngineHeight, 
+			c_EngineHeight 
+		};
+		const float perSegment = c_XOffsetPerSegment;
+		const float fromLeft = segmentIndex * perSegment;
+		const float overhang = engineSize.x - perSegment;
+		const float totalWidth = 
+		{
+			((amountOfSegments - 1) * perSegment) + (overhang / 2.0f)
+		};
+		const float left = -totalWidth / 2.0f;
+		const float xPosition = left + fromLeft;
+		return Rect2f({ xPosition, 0 }, engineSize);
+	}
+
+	vector<string> FloatingPlatformSegment::GetTexturePaths()
+	{
+		return
+		{
+			c_TexturePath
+		};
 	}
 
 	const float FloatingPlatformSegment::c_EngineHeight = 10 / 46.0f;
@@ -200,59 +244,23 @@ namespace BlastOff
 	FloatingPlatform::FloatingPlatform(
 		const CoordinateTransformer* const coordTransformer,
 		const ProgramConstants* const programConstants,
-		ImageTextureLoader* const imageTextureLoader
-	)
+		ImageTextureLoader* const imageTextureLoader,
+		RandomStream* const random
+	) :
+		m_CoordTransformer(coordTransformer),
+		m_ProgramConstants(programConstants),
+		m_ImageTextureLoader(imageTextureLoader)
 	{
-		const auto initializeEmpty = 	
-			[&, this]()
-			{
-				const Vector2f viewportSize = 
-				{
-					coordTransformer->GetViewportSize()
-				};
-				const Vector2f enginePosition = 
-				{
-					(GetRandomFloat() - (1 / 2.0f)) * viewportSize.x,
-					c_SpawningRange.ChooseYPosition()
-				};
-				m_Empty = std::make_unique<Empty>(
-					enginePosition, 
-					coordTransformer, 
-					programConstants
-				);
-			};
-
-		const auto generateSegmentCount = 
-			[this]()
-			{
-				const float randomNumber = GetRandomFloat();
-				
-				const float start = c_MinimumSegmentCount;
-				const float end = c_MaximumSegmentCount;
-				
-				const float result = start + (randomNumber * (end - start));
-				return (size_t)result;
-			};
+		m_Empty = std::make_unique<Empty>(
+			Vector2f::Zero(), 
+			coordTransformer, 
+			programConstants
+		);
 
-		const auto initializeSegments = 
-			[&, this]()
-			{
-				const size_t segmentCount = generateSegmentCount();
-				for (size_t index = 0; index < segmentCount; index++)
-				{
-					m_Segments.emplace_back(
-						m_Empty.get(),
-						index,
-						segmentCount,
-						coordTransformer,
-						programConstants,
-						imageTextureLoader
-					);
-				}
-			};
+		// so a longer respawn never moves the segments
+		m_Segments.reserve(c_MaximumSegmentCount);
 
-		initializeEmpty();
-		initializeSegments();
+		Respawn(random);
 	}
 
 	float FloatingPlatform::GetEdgePosition(const Direction side) const
@@ -261,15 +269,28 @@ namespace BlastOff
 		return backSegment.GetEdgePosition(side);
 	}
 
-	optional<Edge2f> FloatingPlatform::CollideWithPlayer
-		(const Rect2f playerRect) 
+	Rect2f FloatingPlatform::CalculateBounds() const
 	{
-		const auto updateMostRecentPlayerPosition = 
-			[&, this]()
-			{
-				m_MostRecentPlayerPosition = playerRect.GetPosition();
-			};
+		// every segment is the same height, and they're laid out 
+		// left to right, so the ends give the whole platform's bounds
+		const Rect2f front = m_Segments.front().CalculateRealRect();
+		const Rect2f back = m_Segments.back().CalculateRealRect();
+
+		const float left = front.x - (front.w / 2.0f);
+		const float right = back.x + (back.w / 2.0f);
+		return Rect2f((left + right) / 2.0f, front.y, right - left, front.h);
+	}
 
+	bool FloatingPlatform::IsVisible(const Rect2f visibleRect) const
+	{
+		return CalculateBounds().CollideWithRect(visibleRect);
+	}
+
+	optional<Edge2f> FloatingPlatform::CollideWithPlayer(
+		const Rect2f playerRect, 
+		const optional<Vector2f> previousPlayerPosition
+	) const
+	{
 		const float left = 
 		{
 			m_Segments.front().GetEdgePosition(Direction::Left)
@@ -282,15 +303,9 @@ namespace BlastOff
 		const float localizedPlayerX = playerRect.x - emptyPosition.x;
 		
 		if (localizedPlayerX < left)
-		{
-			updateMostRecentPlayerPosition();
 			return std::nullopt;
-		}
 		if (localizedPlayerX > right)
-		{
-			updateMostRecentPlayerPosition();
 			return std::nullopt;
-		}
 
 		const optional<float> playerBottom = 
 		{
@@ -305,22 +320,13 @@ namespace BlastOff
 		// this path should never happen.
 		// it's probably still a good idea, since C++ warnings are evil
 		if (!thisTop)
-		{
-			updateMostRecentPlayerPosition();
 			return std::nullopt;
-		}
 
 		if (playerBottom == *thisTop)
-		{
-			updateMostRecentPlayerPosition();
 			return Edge2f{ Direction::Up, *thisTop };
-		}
 
-		if (!m_MostRecentPlayerPosition)
-		{
-			updateMostRecentPlayerPosition();
+		if (!previousPlayerPosition)
 			return std::nullopt;
-		}
 		if (m_Segments.empty())
 		{
 			const char* const message = 
@@ -333,14 +339,12 @@ namespace BlastOff
 			};
 			Logging::LogWarning(message);
 			
-			updateMostRecentPlayerPosition();
 			return std::nullopt;
 		}
 
-		const Vector2f previousPosition = *m_MostRecentPlayerPosition;
+		const Vector2f previousPosition = *previousPlayerPosition;
 		const Vector2f currentPosition = playerRect.GetPosition();
 		const Vector2f playerVelocity = currentPosition - previousPosition;
-		m_MostRecentPlayerPosition = currentPosition;
 
 		if (playerVelocity.Magnitude() == 0)
 			return std::nullopt;
@@ -374,16 +378,75 @@ namespace BlastOff
 		 	return std::nullopt;
 	}
 
+	void FloatingPlatform::Respawn(RandomStream* const random)
+	{
+		const auto moveEmpty = 	
+			[&, this]()
+			{
+				const Vector2f viewportSize = 
+				{
+					m_CoordTransformer->GetViewportSize()
+				};
+				const Vector2f enginePosition = 
+				{
+					(random->NextFloat() - (1 / 2.0f)) * viewportSize.x,
+					c_SpawningRange.ChooseYPosition(random)
+				};
+				m_Empty->SetLocalPosition(enginePosition);
+			};
+
+		const auto generateSegmentCount = 
+			[&]()
+			{
+				const float randomNumber = random->NextFloat();
+				
+				const float start = c_MinimumSegmentCount;
+				const float end = c_MaximumSegmentCount;
+				
+				const float result = start + (randomNumber * (end - start));
+				return (size_t)result;
+			};
+
+		// the segments already made are only laid out again,
+		// so only a longer platform creates any
+		const auto arrangeSegments = 
+			[&, this]()
+			{
+				const size_t segmentCount = generateSegmentCount();
+				while (m_Segments.size() > segmentCount)
+					m_Segments.pop_back();
+
+				for (size_t index = 0; index < m_Segments.size(); index++)
+					m_Segments[index].Arrange(index, segmentCount);
+
+				const size_t firstNewIndex = m_Segments.size();
+				for (size_t index = firstNewIndex; index < segmentCount; index++)
+				{
+					m_Segments.emplace_back(
+						m_Empty.get(),
+						index,
+						segmentCount,
+						m_CoordTransformer,
+						m_ProgramConstants,
+						m_ImageTextureLoader
+					);
+				}
+			};
+
+		moveEmpty();
+		arrangeSegments();
+	}
+
 	void FloatingPlatform::Update()
 	{
 		for (Segment& segment : m_Segments)
 			segment.Update();
 	}
 
-	void FloatingPlatform::Draw() const
+	void FloatingPlatform::Draw(RenderQueue* const renderQueue) const
 	{
 		for (const Segment& segment : m_Segments)
-			segment.Draw();
+			segment.Draw(renderQueue);
 	}
 
 	const size_t FloatingPlatform::c_Count = 15;
@@ -454,10 +517,12 @@ namespace BlastOff
 		checkForWorldBoundsChange();
 	}
 
-	void Background::Draw() const
+	void Background::Draw(RenderQueue* const renderQueue) const
 	{
-		m_LowerAtmosphereSprite->Draw();
-		m_UpperAtmosphereSprite->Draw();
+		PROFILE_ZONE("Background::Draw");
+
+		m_LowerAtmosphereSprite->Draw(renderQueue);
+		m_UpperAtmosphereSprite->Draw(renderQueue);
 	}
 
 	void Background::InitializeSprites()
@@ -539,276 +604,275 @@ namespace BlastOff
 	}
 
 
-	void Cloud::Update()
+	CloudField::CloudField(
+		const CoordinateTransformer* const coordTransformer,
+		const ProgramConstants* const programConstants,
+		ImageTextureLoader* const imageTextureLoader,
+		RandomStream* const random,
+		const Rect2f* const worldBounds,
+		const Direction movementDirection,
+		Arena* const arena
+	) :
+		m_CoordTransformer(coordTransformer),
+		m_ProgramConstants(programConstants),
+		m_ImageTextureLoader(imageTextureLoader),
+		m_Random(random),
+		m_WorldBounds(worldBounds),
+		m_MovementDirection(movementDirection),
+		m_Kinds(arena->GetResource()),
+		m_KindTextures(arena->GetResource()),
+		m_X(arena->GetResource()),
+		m_Y(arena->GetResource()),
+		m_Speed(arena->GetResource()),
+		m_HalfWidth(arena->GetResource()),
+		m_Kind(arena->GetResource()),
+		m_Layer(arena->GetResource()),
+		m_ShouldRespawn(arena->GetResource())
 	{
-		const auto move =
-			[this]()
-			{
-				const float targetFrametime = 
-				{
-					m_ProgramConstants->GetTargetFrametime()
-				};
-				const float xMovement = CalculateSpeed() * targetFrametime;
-				const Vector2f translation = { xMovement, 0 };
 
-				m_Sprite->Move(translation);
-			};
+	}
 
-		const auto calculateMovementDirection =
-			[this]() -> Direction
-			{
-				if (CalculateSpeed() > 0)
-					return Direction::Right;
-				else
-					return Direction::Left;
-			};
+	void CloudField::Add(const CloudKind& kind, const size_t count)
+	{
+		const size_t kindIndex = FindOrAddKind(kind);
+		const bool isLeftMovement =
+		{
+			m_MovementDirection == Direction::Left
+		};
 
-		const auto reinitializePosition =
-			[this]()
+		const auto reserve =
+			[&, this]()
 			{
-				InitializeYPosition();
-
-				const float maxTranslation = CalculateMaxInitXTranslation();
-				float xTranslation = maxTranslation;
-
-				const bool isRightMovement =
-				{
-					(*m_MovementDirection) == Direction::Right
-				};
-				if (isRightMovement)
-					xTranslation *= -1;
-
-				m_Sprite->Move({ xTranslation, 0 });
+				const size_t length = m_X.size() + count;
+				m_X.reserve(length);
+				m_Y.reserve(length);
+				m_Speed.reserve(length);
+				m_HalfWidth.reserve(length);
+				m_Kind.reserve(length);
+				m_Layer.reserve(length);
+				m_ShouldRespawn.resize(length);
 			};
 
-		const auto checkForRespawn =
+		// draws from the stream in the same order a cloud object did:
+		// height, then offset, then speed, then layer
+		const auto addCloud =
 			[&, this]()
 			{
-				const Direction direction = calculateMovementDirection();
-				const Rect2f engineRect = m_Sprite->GetEngineRect();
+				const float y = kind.spawningRange.ChooseYPosition(m_Random);
 
-				const optional<float> edge =
+				const float maxTranslation =
 				{
-					engineRect.GetOppositeEdgePosition(direction)
+					kind.engineSize.x + m_WorldBounds->w
 				};
-				if (!edge)
-				{
-					const string message =
-					{
-						"Rect2f::GetOppositeEdgePosition"
-						"(" + DirectionToString(direction) + ") failed."
-					};
-					Logging::LogWarning(message.c_str());
-					return;
-				}
+				const float x = m_Random->NextFloat() - 0.5f;
 
-				const optional<float> worldEdge =
+				const float randomSpeed = m_Random->NextFloat() - 0.5f;
+				const float speed =
 				{
-					m_WorldBounds->GetEdgePosition(direction)
+					kind.speedMultiplier * 
+					(1 + (randomSpeed * kind.speedRandomness))
 				};
-				if (!worldEdge)
-				{
-					const string message =
-					{
-						"Rect2f::GetEdgePosition"
-						"(" + DirectionToString(direction) + ") failed."
-					};
-					Logging::LogWarning(message.c_str());
-					return;
-				}
 
-				const bool isLeftMovement = (direction == Direction::Left);
-				const bool isRightMovement = (direction == Direction::Right);
-
-				const bool isGreater = ((*edge) < (*worldEdge));
-				const bool isLesser = ((*edge) > (*worldEdge));
-
-				if (isLeftMovement && isGreater)
-					reinitializePosition();
-				else if (isRightMovement && isLesser)
-					reinitializePosition();
+				const bool drawsAbovePlayer = m_Random->NextFloat() > 0.5f;
+
+				m_X.push_back(maxTranslation * x);
+				m_Y.push_back(y);
+				m_Speed.push_back(isLeftMovement ? -speed : speed);
+				m_HalfWidth.push_back(kind.engineSize.x / 2);
+				m_Kind.push_back((uint8_t)kindIndex);
+				m_Layer.push_back(
+					drawsAbovePlayer ? 
+						RenderLayer::CloudsAbovePlayer : 
+						RenderLayer::CloudsBelowPlayer
+				);
 			};
 
-		move();
-		checkForRespawn();
+		reserve();
+		for (size_t index = 0; index < count; index++)
+			addCloud();
 	}
 
-	void Cloud::Draw() const
+	void CloudField::Update()
 	{
-		m_Sprite->Draw();
-	}
+		PROFILE_ZONE("CloudField::Update");
 
-	bool Cloud::DrawsAbovePlayer() const
-	{
-		return m_DrawsAbovePlayer;
-	}
+		const size_t count = m_X.size();
+		const float frametime = m_ProgramConstants->GetTargetFrametime();
 
-	Cloud::Cloud(
-		const CoordinateTransformer* const coordTransformer,
-		const ProgramConstants* const programConstants,
-		ImageTextureLoader* const imageTextureLoader,
-		const Rect2f* const worldBounds,
-		const Direction* const movementDirection,
-		const char* const texturePath,
-		const SpawningRange spawningRange,
-		const float speedMultiplier,
-		const float speedRandomness,
-		const Vector2f engineSize
-	) :
-		m_ProgramConstants(programConstants),
-		m_WorldBounds(worldBounds),
-		m_MovementDirection(movementDirection),
-		m_SpawningRange(spawningRange),
-		m_SpeedMultiplier(speedMultiplier),
-		m_SpeedRandomness(speedRandomness),
-		m_EngineSize(engineSize)
-	{
-		const auto initializePosition =
-			[this]()
+		// plain loops over raw arrays with no branches,
+		// so the compiler can vectorize them
+		const auto move =
+			[&, this]()
 			{
-				InitializeYPosition();
-
-				const float maxTranslation = CalculateMaxInitXTranslation();
-				const float multiplier = GetRandomFloat() - 0.5f;
-				const float xTranslation = maxTranslation * multiplier;
+				float* const x = m_X.data();
+				const float* const speed = m_Speed.data();
 
-				m_Sprite->Move({ xTranslation, 0 });
+				for (size_t index = 0; index < count; index++)
+					x[index] += speed[index] * frametime;
 			};
 
-		const auto initializeSprite =
+		// a cloud respawns once it's entirely past the world edge
+		// it's moving towards
+		const auto findRespawns =
 			[&, this]()
 			{
-				const Texture* const texture =
-				{
-					imageTextureLoader->LazyLoadTexture(texturePath)
-				};
-				m_Sprite = std::make_unique<ImageSprite>(
-					coordTransformer,
-					programConstants,
-					texture
-				);
-			};
+				const float* const x = m_X.data();
+				const float* const halfWidth = m_HalfWidth.data();
+				uint8_t* const shouldRespawn = m_ShouldRespawn.data();
 
-		const auto calculateRandomSpeedMultiplier =
-			[this]()
-			{
-				const float x = GetRandomFloat() - 0.5f;
-				m_RandomSpeedMultiplier = 1 + (x * m_SpeedRandomness);
+				const float worldHalfWidth = m_WorldBounds->w / 2;
+				if (m_MovementDirection == Direction::Left)
+				{
+					const float worldEdge = m_WorldBounds->x - worldHalfWidth;
+					for (size_t index = 0; index < count; index++)
+					{
+						const float edge = x[index] + halfWidth[index];
+						shouldRespawn[index] = edge < worldEdge;
+					}
+				}
+				else
+				{
+					const float worldEdge = m_WorldBounds->x + worldHalfWidth;
+					for (size_t index = 0; index < count; index++)
+					{
+						const float edge = x[index] - halfWidth[index];
+						shouldRespawn[index] = edge > worldEdge;
+					}
+				}
 			};
 
-		const auto initializeDrawsAbovePlayer =
-			[this]()
+		// rare, and draws from the stream, so it stays in order
+		const auto respawn =
+			[&, this]()
 			{
-				m_DrawsAbovePlayer = GetRandomFloat() > 0.5f;
+				for (size_t index = 0; index < count; index++)
+				{
+					if (m_ShouldRespawn[index])
+						Respawn(index);
+				}
 			};
 
-		initializeSprite();
-		initializePosition();
-		calculateRandomSpeedMultiplier();
-		initializeDrawsAbovePlayer();
+		move();
+		findRespawns();
+		respawn();
 	}
 
-	float Cloud::CalculateSpeed() const
+	size_t CloudField::Draw(
+		RenderQueue* const renderQueue,
+		const Rect2f visibleRect
+	) const
 	{
-		const float unsignedResult = 
-		{
-			m_SpeedMultiplier* m_RandomSpeedMultiplier
-		};
-		const bool isLeftMovement = 
-		{
-			(*m_MovementDirection) == Direction::Left
-		};
+		size_t result = 0;
 
-		if (isLeftMovement)
-			return -unsignedResult;
-		else
-			return unsignedResult;
-	}
+		// mirrors ImageSprite::CalculateQuad(), without a crop or opacity
+		const auto calculateQuad =
+			[this](const size_t index, const Rect2f engineRect)
+			{
+				const TextureRegion* const texture =
+				{
+					m_KindTextures[m_Kind[index]]
+				};
+				Rect2f drawRect =
+				{
+					m_CoordTransformer->ToScreenCoordinates(engineRect)
+				};
 
-	void Cloud::InitializeYPosition()
-	{
-		const float yPosition = m_SpawningRange.ChooseYPosition();
-		const Vector2f enginePosition = { 0, yPosition };
-		const Rect2f engineRect(enginePosition, m_EngineSize);
+				const Vector2f drawOrigin = drawRect.GetSize() / 2.0f;
+				drawRect = drawRect.Translate(drawOrigin);
 
-		m_Sprite->SetEngineRect(engineRect);
+				RenderQuad quad = {};
+				quad.texture = texture->texture;
+				quad.sourceRect = Rect2f(
+					(float)texture->x,
+					(float)texture->y,
+					(float)texture->width,
+					(float)texture->height
+				);
+				quad.destinationRect = drawRect;
+				quad.origin = drawOrigin;
+				return quad;
+			};
+
+		for (size_t index = 0; index < m_X.size(); index++)
+		{
+			const Vector2f size = m_Kinds[m_Kind[index]].engineSize;
+			const Rect2f engineRect(m_X[index], m_Y[index], size.x, size.y);
+			if (!engineRect.CollideWithRect(visibleRect))
+				continue;
+
+			// the queue sorts each layer by texture,
+			// so all of a kind end up in one batch
+			renderQueue->SetLayer(m_Layer[index]);
+			renderQueue->Submit(calculateQuad(index, engineRect));
+			result++;
+		}
+		return result;
 	}
 
-	float Cloud::CalculateMaxInitXTranslation() const
+	void CloudField::Clear(const Direction movementDirection)
 	{
-		const Rect2f engineRect = m_Sprite->GetEngineRect();
-		return engineRect.w + m_WorldBounds->w;
-	}
+		m_MovementDirection = movementDirection;
 
+		m_X.clear();
+		m_Y.clear();
+		m_Speed.clear();
+		m_HalfWidth.clear();
+		m_Kind.clear();
+		m_Layer.clear();
+		m_ShouldRespawn.clear();
+	}
 
-	LowCloud::LowCloud(
-		const CoordinateTransformer* const coordTransformer,
-		const ProgramConstants* const programConstants,
-		ImageTextureLoader* const imageTextureLoader,
-		const Rect2f* const worldBounds,
-		const Direction* const movementDirection
-	) :
-		Cloud(
-			coordTransformer,
-			programConstants,
-			imageTextureLoader,
-			worldBounds,
-			movementDirection,
-			c_TexturePath,
-			c_SpawningRange,
-			c_SpeedMultiplier,
-			c_SpeedRandomness,
-			c_EngineSize
-		)
+	size_t CloudField::GetCount() const
 	{
-		
+		return m_X.size();
 	}
 
-	const char* const LowCloud::c_TexturePath = "props/lowCloud.png";
-	const SpawningRange LowCloud::c_SpawningRange = 
+	size_t CloudField::FindOrAddKind(const CloudKind& kind)
 	{
-		.bottom=50, 
-		.top=261.4863f 
-	};
-	const float LowCloud::c_SpeedMultiplier = 1;
-	const float LowCloud::c_SpeedRandomness = 2 / 10.0f;
-	const Vector2f LowCloud::c_EngineSize = { 2, 1 };
+		for (size_t index = 0; index < m_Kinds.size(); index++)
+		{
+			if (m_Kinds[index].texturePath == kind.texturePath)
+				return index;
+		}
 
+		const TextureRegion* const texture =
+		{
+			m_ImageTextureLoader->LazyLoadTexture(kind.texturePath)
+		};
+		m_Kinds.push_back(kind);
+		m_KindTextures.push_back(texture);
+		return m_Kinds.size() - 1;
+	}
 
-	HighCloud::HighCloud(
-		const CoordinateTransformer* const coordTransformer,
-		const ProgramConstants* const programConstants,
-		ImageTextureLoader* const imageTextureLoader,
-		const Rect2f* const worldBounds,
-		const Direction* const movementDirection
-	) :
-		Cloud(
-			coordTransformer,
-			programConstants,
-			imageTextureLoader,
-			worldBounds,
-			movementDirection,
-			c_TexturePath,
-			c_SpawningRange,
-			c_SpeedMultiplier,
-			c_SpeedRandomness,
-			c_EngineSize
-		)
+	void CloudField::Respawn(const size_t index)
 	{
+		const CloudKind& kind = m_Kinds[m_Kind[index]];
+		const float maxTranslation = kind.engineSize.x + m_WorldBounds->w;
 
+		// back on the side it's moving away from
+		m_Y[index] = kind.spawningRange.ChooseYPosition(m_Random);
+		if (m_MovementDirection == Direction::Right)
+			m_X[index] = -maxTranslation;
+		else
+			m_X[index] = maxTranslation;
 	}
 
-	const char* const HighCloud::c_TexturePath = "props/highCloud.png";
 
-	const SpawningRange HighCloud::c_SpawningRange =
+	const CloudKind CloudKind::c_Low =
 	{
-		.bottom=256,
-		.top=409.6f
+		.texturePath = "props/lowCloud.png",
+		.spawningRange = { .bottom=50, .top=261.4863f },
+		.speedMultiplier = 1,
+		.speedRandomness = 2 / 10.0f,
+		.engineSize = { 2, 1 }
 	};
-	const float HighCloud::c_SpeedMultiplier = 3 / 2.0f;
-	const float HighCloud::c_SpeedRandomness = 2 / 10.0f;
-	const Vector2f HighCloud::c_EngineSize =
+
+	const CloudKind CloudKind::c_High =
 	{
-		7.556392017f * 2 / 3.0f, 2 / 3.0f
+		.texturePath = "props/highCloud.png",
+		.spawningRange = { .bottom=256, .top=409.6f },
+		.speedMultiplier = 3 / 2.0f,
+		.speedRandomness = 2 / 10.0f,
+		.engineSize = { 7.556392017f * 2 / 3.0f, 2 / 3.0f }
 	};
 }
@@ -4,6 +4,8 @@
 #include "Utils.h"
 #include "Graphics.h"
 #include "Debug.h"
+#include "Random.h"
+#include "Arena.h"
 
 namespace BlastOff
 {
@@ -12,7 +14,7 @@ namespace BlastOff
 		float bottom = 0;
 		float top = 0;
 
-		float ChooseYPosition() const;
+		float ChooseYPosition(RandomStream* const random) const;
 	};
 
 	struct Crag
@@ -23,7 +25,9 @@ namespace BlastOff
 			ImageTextureLoader* const imageTextureLoader
 		);
 
-		void Draw() const;
+		void Draw(RenderQueue* const renderQueue) const;
+
+		static vector<string> GetTexturePaths();
 
 	private:
 		static const char* const c_TexturePath;
@@ -47,7 +51,9 @@ namespace BlastOff
 		Line2f GetLeftCollisionLine() const;
 		Line2f GetRightCollisionLine() const;
 
-		void Draw() const;
+		void Draw(RenderQueue* const renderQueue) const;
+
+		static vector<string> GetTexturePaths();
 
 	private:
 		static const char* const c_TexturePath;
@@ -68,8 +74,13 @@ namespace BlastOff
 		float GetEdgePosition(const Direction side) const;
 		Rect2f CalculateRealRect() const;
 
+		// lays the segment out again, for a platform that changed length
+		void Arrange(const size_t segmentIndex, const size_t amountOfSegments);
+
 		void Update();
-		void Draw() const;
+		void Draw(RenderQueue* const renderQueue) const;
+
+		static vector<string> GetTexturePaths();
 
 	private:
 		static const float c_EngineHeight;
@@ -77,6 +88,12 @@ namespace BlastOff
 		static const char* const c_TexturePath;
 
 		unique_ptr<ImageSprite> m_Sprite;
+
+		static Rect2f CalculateEngineRect(
+			const Vector2i imageSize,
+			const size_t segmentIndex,
+			const size_t amountOfSegments
+		);
 	};
 
 	struct FloatingPlatform
@@ -84,14 +101,26 @@ namespace BlastOff
 		FloatingPlatform(
 			const CoordinateTransformer* const coordTransformer,
 			const ProgramConstants* const programConstants,
-			ImageTextureLoader* const imageTextureLoader
+			ImageTextureLoader* const imageTextureLoader,
+			RandomStream* const random
 		);
 
 		float GetEdgePosition(const Direction side) const;
-		optional<Edge2f> CollideWithPlayer(const Rect2f playerRect);
+		Rect2f CalculateBounds() const;
+
+		// the previous position is wherever the player was 
+		// the last time any platform was checked against it
+		optional<Edge2f> CollideWithPlayer(
+			const Rect2f playerRect,
+			const optional<Vector2f> previousPlayerPosition
+		) const;
+		bool IsVisible(const Rect2f visibleRect) const;
+
+		// picks a new position and length, reusing the segments it has
+		void Respawn(RandomStream* const random);
 
 		void Update();
-		void Draw() const;
+		void Draw(RenderQueue* const renderQueue) const;
 
 		static const size_t c_Count;
 		static const bool c_SpawningEnabled;
@@ -107,7 +136,9 @@ namespace BlastOff
 		unique_ptr<Empty> m_Empty = nullptr;
 		vector<Segment> m_Segments = {};
 
-		optional<Vector2f> m_MostRecentPlayerPosition = std::nullopt;
+		const CoordinateTransformer* m_CoordTransformer = nullptr;
+		const ProgramConstants* m_ProgramConstants = nullptr;
+		ImageTextureLoader* m_ImageTextureLoader = nullptr;
 	};
 	
 	struct BackgroundConfiguration
@@ -137,7 +168,7 @@ namespace BlastOff
 		);
 
 		void Update();
-		void Draw() const;
+		void Draw(RenderQueue* const renderQueue) const;
 
 	private:
 		static const inline BackgroundConfiguration c_Config;
@@ -161,82 +192,75 @@ namespace BlastOff
 		void InitializeUpperAtmosphereSprite();
 	};
 
-	struct Cloud
+	// what every cloud of one kind has in common
+	struct CloudKind
 	{
-		void Update();
-		void Draw() const;
-
-		bool DrawsAbovePlayer() const;
-
-	protected:
-		float m_RandomSpeedMultiplier = 0;
-		bool m_DrawsAbovePlayer = false;
-
-		const ProgramConstants* m_ProgramConstants = nullptr;
-		const Rect2f* m_WorldBounds = nullptr;
-		const Direction* m_MovementDirection = nullptr;
-
-		unique_ptr<Sprite> m_Sprite = nullptr;
-
-		Cloud(
-			const CoordinateTransformer* const coordTransformer,
-			const ProgramConstants* const programConstants,
-			ImageTextureLoader* const imageTextureLoader,
-			const Rect2f* const worldBounds,
-			const Direction* const movementDirection,
-			const char* const texturePath,
-			const SpawningRange spawningRange,
-			const float speedMultiplier,
-			const float speedRandomness,
-			const Vector2f engineSize
-		);
-
-		void InitializeYPosition();
-		float CalculateMaxInitXTranslation() const;
-		float CalculateSpeed() const;
-
-	private:
-		float m_SpeedMultiplier = 0;
-		float m_SpeedRandomness = 0;
-		Vector2f m_EngineSize = Vector2f::Zero();
-		SpawningRange m_SpawningRange = {};
+		const char* texturePath = nullptr;
+		SpawningRange spawningRange = {};
+		float speedMultiplier = 0;
+		float speedRandomness = 0;
+		Vector2f engineSize = Vector2f::Zero();
+
+		static const CloudKind c_Low;
+		static const CloudKind c_High;
 	};
 
-	struct LowCloud : public Cloud
+	// every cloud in the game, as parallel arrays rather than objects,
+	// so moving them is a few tight loops over floats
+	struct CloudField
 	{
-		LowCloud(
+		CloudField(
 			const CoordinateTransformer* const coordTransformer,
 			const ProgramConstants* const programConstants,
 			ImageTextureLoader* const imageTextureLoader,
+			RandomStream* const random,
 			const Rect2f* const worldBounds,
-			const Direction* const movementDirection
+			const Direction movementDirection,
+			Arena* const arena
 		);
 
-	private:
-		static const char* const c_TexturePath;
+		// spawns them after any clouds already in the field
+		void Add(const CloudKind& kind, const size_t count);
 
-		static const float c_SpeedMultiplier;
-		static const float c_SpeedRandomness;
-		static const Vector2f c_EngineSize;
-		static const SpawningRange c_SpawningRange;
-	};
+		// removes every cloud, but keeps the textures and the capacity,
+		// so the field can be refilled without allocating
+		void Clear(const Direction movementDirection);
 
-	struct HighCloud : public Cloud
-	{
-		HighCloud(
-			const CoordinateTransformer* const coordTransformer,
-			const ProgramConstants* const programConstants,
-			ImageTextureLoader* const imageTextureLoader,
-			const Rect2f* const worldBounds,
-			const Direction* const movementDirection
-		);
+		void Update();
 
-	private:
-		static const char* const c_TexturePath;
+		// returns how many clouds were visible, and so submitted
+		size_t Draw(
+			RenderQueue* const renderQueue, 
+			const Rect2f visibleRect
+		) const;
 
-		static const float c_SpeedMultiplier;
-		static const float c_SpeedRandomness;
-		static const Vector2f c_EngineSize;
-		static const SpawningRange c_SpawningRange;
+		size_t GetCount() const;
+
+	private:
+		const CoordinateTransformer* m_CoordTransformer = nullptr;
+		const ProgramConstants* m_ProgramConstants = nullptr;
+		ImageTextureLoader* m_ImageTextureLoader = nullptr;
+		RandomStream* m_Random = nullptr;
+		const Rect2f* m_WorldBounds = nullptr;
+		Direction m_MovementDirection = Direction::None;
+
+		// every array is in the game's arena, next to each other
+		ArenaVector<CloudKind> m_Kinds;
+		ArenaVector<const TextureRegion*> m_KindTextures;
+
+		// one element per cloud. positions are engine positions,
+		// and speeds are signed by the movement direction
+		ArenaVector<float> m_X;
+		ArenaVector<float> m_Y;
+		ArenaVector<float> m_Speed;
+		ArenaVector<float> m_HalfWidth;
+		ArenaVector<uint8_t> m_Kind;
+		ArenaVector<RenderLayer> m_Layer;
+
+		// scratch space for Update(), kept to avoid reallocating
+		ArenaVector<uint8_t> m_ShouldRespawn;
+
+		size_t FindOrAddKind(const CloudKind& kind);
+		void Respawn(const size_t index);
 	};
 }
@@ -0,0 +1,116 @@
+#include "Random.h"
+#include "Logging.h"
+
+#include <random>
+
+namespace BlastOff
+{
+	namespace
+	{
+		// splitmix64, the recommended way to seed the xoshiro family
+		uint64_t MixSeed(uint64_t* const state)
+		{
+			uint64_t result = (*state += 0x9E3779B97F4A7C15);
+			result = (result ^ (result >> 30)) * 0xBF58476D1CE4E5B9;
+			result = (result ^ (result >> 27)) * 0x94D049BB133111EB;
+			return result ^ (result >> 31);
+		}
+
+		uint32_t RotateLeft(const uint32_t value, const int amount)
+		{
+			return (value << amount) | (value >> (32 - amount));
+		}
+	}
+
+	RandomStream::RandomStream(const uint64_t seed)
+	{
+		uint64_t mixState = seed;
+		const uint64_t low = MixSeed(&mixState);
+		const uint64_t high = MixSeed(&mixState);
+
+		m_State = 
+		{
+			(uint32_t)low, (uint32_t)(low >> 32),
+			(uint32_t)high, (uint32_t)(high >> 32)
+		};
+	}
+
+	float RandomStream::NextFloat()
+	{
+		// the top 24 bits fill a float's mantissa exactly
+		constexpr float multiplier = 1.0f / (1 << 24);
+		return (NextUInt() >> 8) * multiplier;
+	}
+
+	void RandomStream::FillFloats(float* const destination, const size_t count)
+	{
+		for (size_t index = 0; index < count; index++)
+			destination[index] = NextFloat();
+	}
+
+	uint32_t RandomStream::NextUInt()
+	{
+		const uint32_t result = m_State[0] + m_State[3];
+		const uint32_t shifted = m_State[1] << 9;
+
+		m_State[2] ^= m_State[0];
+		m_State[3] ^= m_State[1];
+		m_State[1] ^= m_State[2];
+		m_State[0] ^= m_State[3];
+
+		m_State[2] ^= shifted;
+		m_State[3] = RotateLeft(m_State[3], 11);
+
+		return result;
+	}
+
+
+	RandomStreams::RandomStreams(const uint64_t seed) :
+		m_Seed(seed)
+	{
+		uint64_t mixState = seed;
+
+		const size_t count = (size_t)Type::Count;
+		m_Streams.reserve(count);
+		for (size_t index = 0; index < count; index++)
+			m_Streams.emplace_back(MixSeed(&mixState));
+	}
+
+	uint64_t RandomStreams::GenerateSeed()
+	{
+		std::random_device device;
+		const uint64_t high = device();
+		const uint64_t low = device();
+		return (high << 32) | low;
+	}
+
+	void RandomStreams::Reseed(const uint64_t seed)
+	{
+		m_Seed = seed;
+
+		uint64_t mixState = seed;
+		for (RandomStream& stream : m_Streams)
+			stream = RandomStream(MixSeed(&mixState));
+	}
+
+	uint64_t RandomStreams::GetSeed() const
+	{
+		return m_Seed;
+	}
+
+	RandomStream* RandomStreams::Get(const RandomStreamType type)
+	{
+		const size_t index = (size_t)type;
+		if (index >= m_Streams.size())
+		{
+			const char* const message = 
+			{
+				"RandomStreams::Get(const RandomStreamType) failed: "
+				"Invalid value of RandomStreamType enum."
+			};
+			Logging::LogWarning(message);
+			return &m_Streams.front();
+		}
+		return &m_Streams.at(index);
+	}
+}
\ No newline at end of file
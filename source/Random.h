@@ -0,0 +1,56 @@
+#pragma once
+
+#include "Utils.h"
+
+namespace BlastOff
+{
+	// xoshiro128+, which is more than random enough for gameplay,
+	// and far cheaper than raylib's process-wide GetRandomValue()
+	struct RandomStream
+	{
+		RandomStream(const uint64_t seed);
+
+		// uniformly distributed in [0, 1)
+		float NextFloat();
+		void FillFloats(float* const destination, const size_t count);
+
+	private:
+		array<uint32_t, 4> m_State = { 0 };
+
+		uint32_t NextUInt();
+	};
+
+	enum class RandomStreamType
+	{
+		Clouds,
+		Powerups,
+		FloatingPlatforms,
+		Player,
+		Input,
+		Effects,
+		Count
+	};
+
+	// every subsystem draws from its own stream,
+	// so an extra random call in one subsystem 
+	// never shifts the sequence of another
+	struct RandomStreams
+	{
+		RandomStreams(const uint64_t seed);
+
+		static uint64_t GenerateSeed();
+
+		// restarts every stream in place, as if newly constructed,
+		// so pointers to the streams stay valid
+		void Reseed(const uint64_t seed);
+
+		uint64_t GetSeed() const;
+		RandomStream* Get(const RandomStreamType type);
+
+	private:
+		using Type = RandomStreamType;
+
+		uint64_t m_Seed = 0;
+		vector<RandomStream> m_Streams = {};
+	};
+}
\ No newline at end of file
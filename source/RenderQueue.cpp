@@ -0,0 +1,250 @@
+#include "RenderQueue.h"
+#include "Graphics.h"
+#include "Profiler.h"
+
+#include "rlgl.h"
+
+#include <algorithm>
+
+namespace BlastOff
+{
+	RenderLayer RenderQueue::GetLayer() const
+	{
+		return m_Layer;
+	}
+
+	const RenderStatistics& RenderQueue::GetStatistics() const
+	{
+		return m_Statistics;
+	}
+
+	void RenderQueue::SetLayer(const RenderLayer layer)
+	{
+		m_Layer = layer;
+	}
+
+	void RenderQueue::Submit(const RenderQuad& quad)
+	{
+		// nothing to sample from, e.g. a text sprite with no message
+		if (!quad.texture)
+			return;
+
+		Command command = {};
+		command.layer = m_Layer;
+		command.sequence = (uint32_t)m_Commands.size();
+		command.quad = quad;
+		m_Commands.push_back(command);
+	}
+
+	void RenderQueue::Submit(const Sprite* const sprite)
+	{
+		Command command = {};
+		command.layer = m_Layer;
+		command.sequence = (uint32_t)m_Commands.size();
+		command.sprite = sprite;
+		m_Commands.push_back(command);
+	}
+
+	void RenderQueue::Flush()
+	{
+		PROFILE_ZONE("RenderQueue::Flush");
+
+		const auto getTextureKey =
+			[](const Command& command) -> unsigned int
+			{
+				if (!IsSortedByTexture(command.layer))
+					return 0;
+
+				// sprites come first, since they're usually 
+				// the backgrounds of whatever else is in the layer
+				if (command.sprite)
+					return 0;
+
+				return command.quad.texture->id;
+			};
+
+		const auto sortCommands =
+			[&, this]()
+			{
+				std::sort(
+					m_Commands.begin(),
+					m_Commands.end(),
+					[&](const Command& left, const Command& right)
+					{
+						if (left.layer != right.layer)
+							return left.layer < right.layer;
+
+						const unsigned int leftKey = getTextureKey(left);
+						const unsigned int rightKey = getTextureKey(right);
+						if (leftKey != rightKey)
+							return leftKey < rightKey;
+
+						return left.sequence < right.sequence;
+					}
+				);
+			};
+
+		const Texture* batchTexture = nullptr;
+
+		const auto endBatch =
+			[&]()
+			{
+				if (!batchTexture)
+					return;
+
+#if !COMPILE_CONFIG_TESTING
+				rlEnd();
+				rlSetTexture(0);
+#endif
+				batchTexture = nullptr;
+			};
+
+		const auto beginBatch =
+			[&, this](const Texture* const texture)
+			{
+				endBatch();
+
+#if !COMPILE_CONFIG_TESTING
+				rlSetTexture(texture->id);
+				rlBegin(RL_QUADS);
+#endif
+				batchTexture = texture;
+				m_Statistics.batchCount++;
+			};
+
+		const auto drawCommand =
+			[&, this](const Command& command)
+			{
+				if (command.sprite)
+				{
+					endBatch();
+					command.sprite->DrawImmediately();
+					m_Statistics.batchCount++;
+					return;
+				}
+
+				const Texture* const texture = command.quad.texture;
+				if (!batchTexture || (batchTexture->id != texture->id))
+					beginBatch(texture);
+
+				AddVertices(command.quad);
+			};
+
+		sortCommands();
+
+		m_Statistics = {};
+		m_Statistics.commandCount = m_Commands.size();
+
+		for (const Command& command : m_Commands)
+			drawCommand(command);
+		endBatch();
+
+		// keeps its capacity, so later frames don't allocate
+		m_Commands.clear();
+	}
+
+	void RenderQueue::DrawQuad(const RenderQuad& quad)
+	{
+		if (!quad.texture)
+			return;
+
+#if !COMPILE_CONFIG_TESTING
+		rlSetTexture(quad.texture->id);
+		rlBegin(RL_QUADS);
+		AddVertices(quad);
+		rlEnd();
+		rlSetTexture(0);
+#endif
+	}
+
+	bool RenderQueue::IsSortedByTexture(const RenderLayer layer)
+	{
+		// everything else stacks, 
+		// so it has to be drawn in the order it was submitted
+		switch (layer)
+		{
+			case RenderLayer::Background:
+			case RenderLayer::CloudsBelowPlayer:
+			case RenderLayer::Powerups:
+			case RenderLayer::Platforms:
+			case RenderLayer::CloudsAbovePlayer:
+				return true;
+
+			default:
+				return false;
+		}
+	}
+
+	// the same vertices DrawTexturePro() would make
+	void RenderQueue::AddVertices(const RenderQuad& quad)
+	{
+		struct Corners
+		{
+			Vector2f topLeft;
+			Vector2f topRight;
+			Vector2f bottomLeft;
+			Vector2f bottomRight;
+		};
+
+		const auto calculateCorners =
+			[&]() -> Corners
+			{
+				const Rect2f rect = quad.destinationRect;
+				const float radians = ToRadians(quad.rotation);
+				const float sinTheta = sinf(radians);
+				const float cosTheta = cosf(radians);
+
+				// relative to the origin, before rotating
+				const auto transform =
+					[&](const float x, const float y) -> Vector2f
+					{
+						const float left = x - quad.origin.x;
+						const float top = y - quad.origin.y;
+						return Vector2f(
+							rect.x + (left * cosTheta) - (top * sinTheta),
+							rect.y + (left * sinTheta) + (top * cosTheta)
+						);
+					};
+
+				const Corners result =
+				{
+					transform(0, 0),
+					transform(rect.w, 0),
+					transform(0, rect.h),
+					transform(rect.w, rect.h)
+				};
+				return result;
+			};
+
+		const Texture& texture = *quad.texture;
+		const Rect2f source = quad.sourceRect;
+		const float left = source.x / texture.width;
+		const float right = (source.x + source.w) / texture.width;
+		const float top = source.y / texture.height;
+		const float bottom = (source.y + source.h) / texture.height;
+
+		const Corners corners = calculateCorners();
+		const Colour4i tint = quad.tint;
+
+#if !COMPILE_CONFIG_TESTING
+		// may draw what's been batched so far,
+		// if there's no room left for another quad
+		rlCheckRenderBatchLimit(4);
+
+		rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+		rlNormal3f(0, 0, 1);
+
+		rlTexCoord2f(left, top);
+		rlVertex2f(corners.topLeft.x, corners.topLeft.y);
+
+		rlTexCoord2f(left, bottom);
+		rlVertex2f(corners.bottomLeft.x, corners.bottomLeft.y);
+
+		rlTexCoord2f(right, bottom);
+		rlVertex2f(corners.bottomRight.x, corners.bottomRight.y);
+
+		rlTexCoord2f(right, top);
+		rlVertex2f(corners.topRight.x, corners.topRight.y);
+#endif
+	}
+}
\ No newline at end of file
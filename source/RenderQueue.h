@@ -0,0 +1,70 @@
+#pragma once
+
+#include "Utils.h"
+#include "Enums.h"
+
+#include "raylib.h"
+
+namespace BlastOff
+{
+	struct Sprite;
+
+	// one textured rectangle, in screen coordinates.
+	// rotation is in degrees, around the origin
+	struct RenderQuad
+	{
+		const Texture* texture = nullptr;
+		Rect2f sourceRect = Rect2f(0, 0, 0, 0);
+		Rect2f destinationRect = Rect2f(0, 0, 0, 0);
+		Vector2f origin = Vector2f::Zero();
+		float rotation = 0;
+		Colour4i tint = c_White;
+	};
+
+	struct RenderStatistics
+	{
+		size_t commandCount = 0;
+
+		// texture changes, plus anything drawn on its own
+		size_t batchCount = 0;
+	};
+
+	// collects a frame's draws, then sorts them by layer and texture,
+	// so each run of quads sharing a texture is handed to rlgl at once.
+	// anything that isn't a quad is drawn by its sprite when reached
+	struct RenderQueue
+	{
+		RenderLayer GetLayer() const;
+		const RenderStatistics& GetStatistics() const;
+
+		// applies to everything submitted until the next call
+		void SetLayer(const RenderLayer layer);
+
+		void Submit(const RenderQuad& quad);
+		void Submit(const Sprite* const sprite);
+
+		void Flush();
+
+		static void DrawQuad(const RenderQuad& quad);
+
+	private:
+		struct Command
+		{
+			RenderLayer layer = RenderLayer::Background;
+			uint32_t sequence = 0;
+
+			// only set if the command isn't a quad
+			const Sprite* sprite = nullptr;
+			RenderQuad quad = {};
+		};
+
+		RenderLayer m_Layer = RenderLayer::Background;
+		vector<Command> m_Commands = {};
+
+		// from the last flush
+		RenderStatistics m_Statistics = {};
+
+		static bool IsSortedByTexture(const RenderLayer layer);
+		static void AddVertices(const RenderQuad& quad);
+	};
+}
\ No newline at end of file
@@ -17,13 +17,13 @@
 namespace BlastOff
 {
     unique_ptr<Settings> Settings::LoadOrDefault(
+        const ParsedFile* const parsedFile,
         const Vector2f aspectRatio,
         const int windowSizeIncrement
     )
     {
-        unique_ptr<Settings> attempt = LoadFromDefaultPath(aspectRatio);
-        if (attempt)
-            return attempt;
+        if (parsedFile)
+            return std::make_unique<Settings>(*parsedFile, aspectRatio);
         else
         {
             return std::make_unique<Settings>(
@@ -242,8 +242,7 @@ namespace BlastOff
     }
 #endif
 
-    unique_ptr<Settings> Settings::LoadFromDefaultPath
-        (const Vector2f aspectRatio)
+    unique_ptr<Settings::ParsedFile> Settings::ParseDefaultFile()
     {
         std::ifstream reader(c_DefaultPath);
         if (!reader)
@@ -277,12 +276,11 @@ namespace BlastOff
             BreakProgram();
         }
 
-        const Reflectable reflectable = parseResult.value();
-        return std::make_unique<Settings>(reflectable, aspectRatio);
+        return std::make_unique<Reflectable>(parseResult.value());
 #else
-        Document document;
-        document.Parse(text.c_str());
-        return std::make_unique<Settings>(document, aspectRatio);
+        unique_ptr<Document> result = std::make_unique<Document>();
+        result->Parse(text.c_str());
+        return result;
 #endif
     }
 
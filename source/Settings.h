@@ -37,9 +37,19 @@ namespace BlastOff
     {
 #if USE_GLAZE
         using Reflectable = ReflectableSettings;
+        using ParsedFile = Reflectable;
+#else
+        using ParsedFile = Document;
 #endif
 
+        // reads and parses the settings file without touching the window,
+        // so any thread can call it. nullptr if there's no file to read
+        static unique_ptr<ParsedFile> ParseDefaultFile();
+
+        // from a file parsed ahead of time, or the defaults without one.
+        // the screen size comes from the window, so it has to be open
         static unique_ptr<Settings> LoadOrDefault(
+            const ParsedFile* const parsedFile,
             const Vector2f aspectRatio,
             const int windowSizeIncrement
         );
@@ -82,9 +92,6 @@ namespace BlastOff
         Vector2i m_WindowPosition = Vector2i::Zero();
         Vector2i m_WindowSize = Vector2i::Zero();
 
-        static unique_ptr<Settings> LoadFromDefaultPath
-            (const Vector2f aspectRatio);
-
 #if USE_GLAZE
         Reflectable ToReflectable() const;
 #else
@@ -0,0 +1,286 @@
+#include "Simulation.h"
+#include "Game.h"
+#include "Graphics.h"
+#include "Logging.h"
+#include "OperatingSystem.h"
+
+#include <algorithm>
+#include <format>
+#include <thread>
+
+namespace BlastOff
+{
+	MonteCarloRunner::MonteCarloRunner(const ProgramArguments& arguments)
+	{
+		const auto calculateThreadCount =
+			[&]() -> uint64_t
+			{
+				const uint64_t hardwareThreads =
+				{
+					std::max(std::thread::hardware_concurrency(), 1u)
+				};
+				const uint64_t requested =
+				{
+					arguments.threadCount.value_or(hardwareThreads)
+				};
+				return std::clamp(requested, (uint64_t)1, m_GameCount);
+			};
+
+		const auto loadFont =
+			[this]()
+			{
+				const string& fontFace = c_Config.GetFontFace();
+				const string fontPath = GetFontPath(fontFace.c_str(), "ttf");
+				const int fontSize = c_Config.GetFontRenderSize();
+
+				m_Font = TextTextureLoader::LoadHeadlessFont(
+					fontPath.c_str(),
+					fontSize
+				);
+			};
+
+		Logging::Initialize(&c_Config);
+
+		m_GameCount = std::max(arguments.gameCount.value_or(1), (uint64_t)1);
+		m_ThreadCount = calculateThreadCount();
+		m_Seed = arguments.seed.value_or(c_DefaultSeed);
+
+		loadFont();
+		m_Results.resize(m_GameCount);
+	}
+
+	MonteCarloRunner::~MonteCarloRunner()
+	{
+		TextTextureLoader::UnloadHeadlessFont(m_Font);
+	}
+
+	void MonteCarloRunner::Run()
+	{
+		const auto start = high_resolution_clock::now();
+
+		vector<std::thread> workers = {};
+		workers.reserve(m_ThreadCount);
+		for (uint64_t index = 0; index < m_ThreadCount; index++)
+			workers.emplace_back([this]() { RunWorker(); });
+
+		for (std::thread& worker : workers)
+			worker.join();
+
+		const auto duration = high_resolution_clock::now() - start;
+		const auto ns = duration_cast<nanoseconds>(duration).count();
+		m_ElapsedSeconds = ns / powf(10, 9);
+	}
+
+	void MonteCarloRunner::PrintReport() const
+	{
+		struct Interval
+		{
+			float lower;
+			float upper;
+		};
+
+		// the Wilson score interval stays inside [0, 1],
+		// even when nearly every game is won or lost
+		const auto calculateConfidenceInterval =
+			[](const uint64_t successes, const uint64_t trials) -> Interval
+			{
+				if (!trials)
+					return { 0, 0 };
+
+				const float n = (float)trials;
+				const float p = successes / n;
+				const float z = c_ConfidenceZScore;
+				const float zSquared = z * z;
+
+				const float denominator = 1 + (zSquared / n);
+				const float center = (p + (zSquared / (2 * n))) / denominator;
+				const float margin =
+				{
+					z * sqrtf((p * (1 - p) / n) + (zSquared / (4 * n * n))) /
+					denominator
+				};
+				return { center - margin, center + margin };
+			};
+
+		const auto collectSeconds =
+			[this](const GameOutcome outcome) -> vector<float>
+			{
+				const float frametime = c_Config.GetTargetFrametime();
+
+				vector<float> result = {};
+				for (const SimulationResult& game : m_Results)
+					if (game.outcome == outcome)
+						result.push_back(game.tickCount * frametime);
+
+				std::sort(result.begin(), result.end());
+				return result;
+			};
+
+		const auto calculatePercentile =
+			[](const vector<float>& sorted, const float percentile) -> float
+			{
+				const float rank = ceilf(percentile * sorted.size());
+				const size_t index = std::max((size_t)rank, (size_t)1) - 1;
+				return sorted.at(std::min(index, sorted.size() - 1));
+			};
+
+		const auto logDistribution =
+			[&](const char* const name, const vector<float>& sorted)
+			{
+				if (sorted.empty())
+					return;
+
+				float sum = 0;
+				for (const float seconds : sorted)
+					sum += seconds;
+
+				const string message = std::format(
+					"{} time-to-outcome: mean {:.2f}s, p50 {:.2f}s, "
+					"p90 {:.2f}s, p99 {:.2f}s, max {:.2f}s",
+					name,
+					sum / sorted.size(),
+					calculatePercentile(sorted, 0.5f),
+					calculatePercentile(sorted, 0.9f),
+					calculatePercentile(sorted, 0.99f),
+					sorted.back()
+				);
+				Logging::Log(message.c_str());
+			};
+
+		const vector<float> winSeconds = collectSeconds(GameOutcome::Winner);
+		const vector<float> lossSeconds = collectSeconds(GameOutcome::Loser);
+
+		const uint64_t winCount = winSeconds.size();
+		const uint64_t lossCount = lossSeconds.size();
+		const uint64_t decidedCount = winCount + lossCount;
+		const uint64_t timeoutCount = m_GameCount - decidedCount;
+
+		uint64_t tickCount = 0;
+		for (const SimulationResult& game : m_Results)
+			tickCount += game.tickCount;
+
+		const float winRate =
+		{
+			decidedCount ? (winCount / (float)decidedCount) : 0
+		};
+		const Interval interval =
+		{
+			calculateConfidenceInterval(winCount, decidedCount)
+		};
+		const float simulatedSeconds =
+		{
+			tickCount * c_Config.GetTargetFrametime()
+		};
+
+		string message = std::format(
+			"Simulated {} games on {} threads (seed {}).",
+			m_GameCount,
+			m_ThreadCount,
+			m_Seed
+		);
+		Logging::Log(message.c_str());
+
+		message = std::format(
+			"Wins: {}, losses: {}, timeouts: {}",
+			winCount,
+			lossCount,
+			timeoutCount
+		);
+		Logging::Log(message.c_str());
+
+		message = std::format(
+			"Win rate: {:.2f}% (95% CI {:.2f}% - {:.2f}%)",
+			winRate * 100,
+			interval.lower * 100,
+			interval.upper * 100
+		);
+		Logging::Log(message.c_str());
+
+		logDistribution("Win", winSeconds);
+		logDistribution("Loss", lossSeconds);
+
+		message = std::format(
+			"Throughput: {:.1f} games/sec, {:.1f}x real-time ({:.2f}s wall)",
+			m_GameCount / m_ElapsedSeconds,
+			simulatedSeconds / m_ElapsedSeconds,
+			m_ElapsedSeconds
+		);
+		Logging::Log(message.c_str());
+	}
+
+	void MonteCarloRunner::RunWorker()
+	{
+		// every worker owns its own loaders and camera,
+		// since none of them are safe to share between threads
+		constexpr bool isHeadless = true;
+
+		AssetManager assetManager = {};
+		ImageTextureLoader imageTextureLoader(&assetManager, isHeadless);
+		TextTextureLoader textTextureLoader(&m_Font, isHeadless);
+
+		const Vector2i windowSize = c_Config.CalculateHeadlessWindowSize();
+		const Vector2i windowPosition = Vector2i::Zero();
+		Vector2f cameraPosition = Vector2f::Zero();
+
+		CoordinateTransformer coordTransformer(
+			&windowSize,
+			&windowPosition,
+			&cameraPosition
+		);
+		coordTransformer.Update();
+
+		CameraEmpty cameraEmpty(&coordTransformer, &c_Config, &cameraPosition);
+
+		const auto runGame =
+			[&](const uint64_t gameIndex) -> SimulationResult
+			{
+				cameraPosition = Vector2f::Zero();
+				cameraEmpty.Update();
+
+				const auto resetCallback = []() {};
+				Cutscene cutscene(
+					&c_Config,
+					&coordTransformer,
+					&cameraEmpty,
+					&imageTextureLoader,
+					&textTextureLoader,
+					&cameraPosition,
+					nullptr,
+					resetCallback,
+					GamePopulation::Default(),
+					m_Seed + gameIndex
+				);
+
+				SimulationResult result = {};
+				while (result.tickCount < c_MaxTicksPerGame)
+				{
+					cutscene.Update();
+					cameraEmpty.Update();
+					result.tickCount++;
+
+					result.outcome = cutscene.GetOutcome();
+					if (result.outcome != GameOutcome::None)
+						break;
+				}
+				return result;
+			};
+
+		while (true)
+		{
+			const uint64_t gameIndex = m_NextGameIndex++;
+			if (gameIndex >= m_GameCount)
+				return;
+
+			m_Results.at(gameIndex) = runGame(gameIndex);
+		}
+	}
+
+	const uint64_t MonteCarloRunner::c_DefaultSeed = 0;
+
+	// ten minutes of game time at 60 ticks per second,
+	// which is far longer than any autopilot run should take
+	const uint64_t MonteCarloRunner::c_MaxTicksPerGame = 60 * 60 * 10;
+
+	// 95% confidence
+	const float MonteCarloRunner::c_ConfidenceZScore = 1.96f;
+}
\ No newline at end of file
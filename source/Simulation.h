@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Utils.h"
+#include "Enums.h"
+#include "Program.h"
+#include "ProgramConstants.h"
+
+#include "raylib.h"
+
+#include <atomic>
+
+namespace BlastOff
+{
+	struct SimulationResult
+	{
+		GameOutcome outcome = GameOutcome::None;
+		uint64_t tickCount = 0;
+	};
+
+	// plays many headless cutscene games across all cores.
+	// every game is seeded from its index,
+	// so a batch gives the same results no matter how many threads run it
+	struct MonteCarloRunner
+	{
+		MonteCarloRunner(const ProgramArguments& arguments);
+		~MonteCarloRunner();
+
+		void Run();
+		void PrintReport() const;
+
+	private:
+		static const inline ProgramConstants c_Config;
+
+		static const uint64_t c_DefaultSeed;
+		static const uint64_t c_MaxTicksPerGame;
+		static const float c_ConfidenceZScore;
+
+		uint64_t m_GameCount = 0;
+		uint64_t m_ThreadCount = 0;
+		uint64_t m_Seed = 0;
+
+		Font m_Font = { 0 };
+
+		vector<SimulationResult> m_Results = {};
+		std::atomic<uint64_t> m_NextGameIndex = 0;
+		float m_ElapsedSeconds = 0;
+
+		void RunWorker();
+	};
+}
\ No newline at end of file
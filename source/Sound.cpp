@@ -1,6 +1,9 @@
 #include "Sound.h"
 #include "Logging.h"
 #include "OperatingSystem.h"
+#include "Profiler.h"
+
+#include <filesystem>
 
 namespace BlastOff
 {
@@ -42,6 +45,20 @@ namespace BlastOff
 				return result;
 		}
 
+		// streamed, so only as big as the file itself
+		size_t CalculateOGGSize(const char* const resourcePath)
+		{
+			const static string start = string("resource/ogg/");
+			const string resultingPath = start + resourcePath;
+
+			std::error_code error;
+			const auto result = std::filesystem::file_size(resultingPath, error);
+			if (error)
+				return 0;
+
+			return (size_t)result;
+		}
+
 		Music LoadOGGMusic(const char* const resourcePath)
 		{
 			const static string start = string("resource/ogg/");
@@ -59,85 +76,330 @@ namespace BlastOff
 		}
 	}
 
+	SoundLoader::SoundLoader(
+		AssetManager* const assetManager, 
+		const bool isHeadless
+	) :
+		m_IsHeadless(isHeadless),
+		m_AssetManager(assetManager)
+	{
+
+	}
+
 	SoundLoader::~SoundLoader()
 	{
-		for (const auto& [name, sound] : m_CachedValues)
+		for (const Sound& sound : m_Sounds)
+		{
+			if (sound.frameCount)
+				UnloadSound(sound);
+		}
+	}
+
+	SoundHandle SoundLoader::Resolve(const string_view resourcePath)
+	{
+		return m_AssetManager->Resolve<AssetType::Sound>(resourcePath);
+	}
+
+	const Sound* SoundLoader::LazyLoadSound(const SoundHandle handle)
+	{
+		if (!handle.IsValid())
 		{
-			(void)name;
-			UnloadSound(sound);
+			Logging::LogWarning(
+				"SoundLoader::LazyLoadSound() failed: "
+				"The handle is invalid."
+			);
+			return nullptr;
 		}
+
+		m_AssetManager->AddReference(handle);
+		if (m_AssetManager->GetRecord(handle).isLoaded)
+			return GetSound(handle);
+
+		m_AssetManager->OnLazyLoad(handle);
+		return LoadAndInsert(handle);
 	}
 
 	const Sound* SoundLoader::LazyLoadSound(const char* const resourcePath)
 	{
-		const auto getCachedValue =
-			[&, this]() -> const Sound*
+		return LazyLoadSound(Resolve(resourcePath));
+	}
+
+	void DecodedSound::Unload() const
+	{
+		if (!isMapped)
+			UnloadWave(wave);
+	}
+
+
+	optional<DecodedSound> SoundLoader::DecodeWAV
+		(const string& resourcePath) const
+	{
+		const AssetLoadTimer timer;
+		const optional<Wave> archived = FindArchivedWave(resourcePath);
+		if (archived)
+		{
+			DecodedSound result = {};
+			result.path = resourcePath;
+			result.wave = *archived;
+			result.isMapped = true;
+			result.loadTime = timer.CalculateElapsed();
+			return result;
+		}
+
+		const static string start = string("resource/wav/");
+		const string resultingPath = start + resourcePath;
+
+		const Wave wave = LoadWave(resultingPath.c_str());
+		if (!wave.frameCount)
+			return std::nullopt;
+
+		DecodedSound result = {};
+		result.path = resourcePath;
+		result.wave = wave;
+		result.loadTime = timer.CalculateElapsed();
+		return result;
+	}
+
+	const Sound* SoundLoader::InsertDecodedSound(const DecodedSound& decoded)
+	{
+		PROFILE_ZONE("SoundLoader::InsertDecodedSound");
+
+		const SoundHandle handle = Resolve(decoded.path);
+		Sound* const result = GetSound(handle);
+		if (m_IsHeadless || m_AssetManager->GetRecord(handle).isLoaded)
+		{
+			decoded.Unload();
+			return result;
+		}
+
+		// the decode happened elsewhere, so only this part is timed here
+		const AssetLoadTimer timer;
+		*result = LoadSoundFromWave(decoded.wave);
+		decoded.Unload();
+
+		const Wave& wave = decoded.wave;
+		const size_t byteSize =
+		{
+			(size_t)wave.frameCount * wave.channels * wave.sampleSize / 8
+		};
+		const uint64_t loadTime = decoded.loadTime + timer.CalculateElapsed();
+		m_AssetManager->MarkLoaded(handle, byteSize, loadTime);
+		return result;
+	}
+
+	Sound* SoundLoader::GetSound(const SoundHandle handle)
+	{
+		if (handle.index >= m_Sounds.size())
+			m_Sounds.resize(handle.index + 1, Sound{ 0 });
+
+		return &m_Sounds[handle.index];
+	}
+
+	optional<Wave> SoundLoader::FindArchivedWave
+		(const string_view resourcePath) const
+	{
+		const AssetArchive* const archive = m_AssetManager->GetArchive();
+		if (!archive)
+			return std::nullopt;
+
+		const string archivePath = "wav/" + string(resourcePath);
+		const optional<ArchivedAsset> asset = archive->Find(archivePath);
+		if (!asset || (asset->entry->type != ArchiveEntryType::RawWave))
+			return std::nullopt;
+
+		// a truncated entry would have raylib read past the mapping
+		const ArchiveEntry& entry = *asset->entry;
+		constexpr uint64_t bitsPerByte = 8;
+		const uint64_t expectedSize =
+		{
+			(uint64_t)entry.frameCount * entry.channels * 
+				entry.sampleSize / bitsPerByte
+		};
+		if (entry.dataSize < expectedSize)
+		{
+			const string message =
 			{
-				try
-				{
-					return &m_CachedValues.at(resourcePath);
-				}
-				catch (const std::out_of_range& exception)
-				{
-					(void)exception;
-					return nullptr;
-				}
+				"SoundLoader::FindArchivedWave() failed: "
+				"\"" + archivePath + "\" is smaller than its size says. "
+				"Loading the loose file instead."
 			};
+			Logging::LogWarning(message.c_str());
+			return std::nullopt;
+		}
 
-		const auto result = getCachedValue();
-		if (!result)
-			return LoadAndInsert(resourcePath);
-		else
-			return result;
+		Wave result = {};
+		result.frameCount = entry.frameCount;
+		result.sampleRate = entry.sampleRate;
+		result.sampleSize = entry.sampleSize;
+		result.channels = entry.channels;
+		result.data = (void*)asset->data;
+		return result;
 	}
 
-	const Sound* SoundLoader::LoadAndInsert(const char* const resourcePath)
+	const Sound* SoundLoader::LoadAndInsert(const SoundHandle handle)
 	{
-		const Sound result = LoadWAVSound(resourcePath);
-		m_CachedValues.insert({ resourcePath, result });
+		PROFILE_ZONE("SoundLoader::LoadAndInsert");
+
+		const AssetLoadTimer timer;
+		const string& resourcePath = m_AssetManager->GetRecord(handle).path;
 
-		return &m_CachedValues.at(resourcePath);
+		const auto load =
+			[&, this]() -> Sound
+			{
+				if (m_IsHeadless)
+					return Sound{ 0 };
+
+				const optional<Wave> archived = FindArchivedWave(resourcePath);
+				if (archived)
+					return LoadSoundFromWave(*archived);
+
+				return LoadWAVSound(resourcePath.c_str());
+			};
+
+		Sound* const result = GetSound(handle);
+		*result = load();
+
+		// decoded up front, so every frame is in memory
+		const AudioStream& stream = result->stream;
+		const size_t byteSize =
+		{
+			(size_t)result->frameCount * 
+			stream.channels * 
+			stream.sampleSize / 8
+		};
+		m_AssetManager->MarkLoaded(handle, byteSize, timer.CalculateElapsed());
+		return result;
 	}
 
 
+	MusicLoader::MusicLoader(
+		AssetManager* const assetManager, 
+		const bool isHeadless
+	) :
+		m_IsHeadless(isHeadless),
+		m_AssetManager(assetManager)
+	{
+
+	}
+
 	MusicLoader::~MusicLoader()
 	{
-		for (const auto& [name, music] : m_CachedValues)
+		for (const Music& music : m_Music)
+		{
+			if (music.frameCount)
+				UnloadMusicStream(music);
+		}
+	}
+
+	MusicHandle MusicLoader::Resolve(const string_view resourcePath)
+	{
+		return m_AssetManager->Resolve<AssetType::Music>(resourcePath);
+	}
+
+	const Music* MusicLoader::LazyLoadMusic(const MusicHandle handle)
+	{
+		if (!handle.IsValid())
 		{
-			(void)name;
-			UnloadMusicStream(music);
+			Logging::LogWarning(
+				"MusicLoader::LazyLoadMusic() failed: "
+				"The handle is invalid."
+			);
+			return nullptr;
 		}
+
+		m_AssetManager->AddReference(handle);
+		if (m_AssetManager->GetRecord(handle).isLoaded)
+			return GetMusic(handle);
+
+		m_AssetManager->OnLazyLoad(handle);
+		return LoadAndInsert(handle);
 	}
 
 	const Music* MusicLoader::LazyLoadMusic(const char* const resourcePath)
 	{
-		const auto getCachedValue =
-			[&, this]() -> const Music*
-			{
-				try
-				{
-					return &m_CachedValues.at(resourcePath);
-				}
-				catch (const std::out_of_range& exception)
-				{
-					(void)exception;
-					return nullptr;
-				}
-			};
+		return LazyLoadMusic(Resolve(resourcePath));
+	}
 
-		const auto result = getCachedValue();
-		if (!result)
-			return LoadAndInsert(resourcePath);
-		else
-			return result;
+	void MusicLoader::Preload(const MusicHandle handle)
+	{
+		if (!handle.IsValid())
+			return;
+
+		if (!m_AssetManager->GetRecord(handle).isLoaded)
+			LoadAndInsert(handle);
 	}
 
-	const Music* MusicLoader::LoadAndInsert(const char* const resourcePath)
+	Music* MusicLoader::GetMusic(const MusicHandle handle)
 	{
-		const Music result = LoadOGGMusic(resourcePath);
-		m_CachedValues.insert({ resourcePath, result });
+		if (handle.index >= m_Music.size())
+			m_Music.resize(handle.index + 1, Music{ 0 });
 
-		return &m_CachedValues.at(resourcePath);
+		return &m_Music[handle.index];
+	}
+
+	optional<ArchivedAsset> MusicLoader::FindArchivedMusic
+		(const string_view resourcePath) const
+	{
+		const AssetArchive* const archive = m_AssetManager->GetArchive();
+		if (!archive)
+			return std::nullopt;
+
+		const string archivePath = "ogg/" + string(resourcePath);
+		const optional<ArchivedAsset> result = archive->Find(archivePath);
+		if (!result || (result->entry->type != ArchiveEntryType::File))
+			return std::nullopt;
+
+		return result;
+	}
+
+	const Music* MusicLoader::LoadAndInsert(const MusicHandle handle)
+	{
+		PROFILE_ZONE("MusicLoader::LoadAndInsert");
+
+		const AssetLoadTimer timer;
+		const char* const resourcePath =
+		{
+			m_AssetManager->GetRecord(handle).path.c_str()
+		};
+
+		// streamed straight out of the mapping, which outlives every stream
+		const optional<ArchivedAsset> archived =
+		{
+			FindArchivedMusic(resourcePath)
+		};
+		const auto load =
+			[&]() -> Music
+			{
+				if (m_IsHeadless)
+					return Music{ 0 };
+
+				if (!archived)
+					return LoadOGGMusic(resourcePath);
+
+				return LoadMusicStreamFromMemory(
+					".ogg",
+					archived->data,
+					(int)archived->entry->dataSize
+				);
+			};
+
+		Music* const result = GetMusic(handle);
+		*result = load();
+
+		const auto calculateByteSize =
+			[&]() -> size_t
+			{
+				if (m_IsHeadless)
+					return 0;
+
+				if (archived)
+					return (size_t)archived->entry->dataSize;
+
+				return CalculateOGGSize(resourcePath);
+			};
+		const size_t byteSize = calculateByteSize();
+		m_AssetManager->MarkLoaded(handle, byteSize, timer.CalculateElapsed());
+		return result;
 	}
 
 
@@ -185,6 +447,8 @@ namespace BlastOff
 
 	void MusicLoop::Update()
 	{
+		PROFILE_ZONE("MusicLoop::Update");
+
 		const float playTime = GetMusicTimePlayed(*m_Song);
 		if (playTime >= m_LoopEnd)
 			SeekMusicStream(*m_Song, m_LoopStart);
@@ -1,29 +1,85 @@
 #pragma once
 
 #include "Utils.h"
+#include "AssetManager.h"
 
 #include "raylib.h"
 
+#include <deque>
+
 namespace BlastOff
 {
+	// a WAV decoded into memory, but not yet handed to the device
+	struct DecodedSound
+	{
+		string path = "";
+		Wave wave = { 0 };
+
+		// in nanoseconds, just for the decode
+		uint64_t loadTime = 0;
+
+		// points into the asset archive, so it's never freed
+		bool isMapped = false;
+
+		void Unload() const;
+	};
+
 	struct SoundLoader
 	{
+		SoundLoader(AssetManager* const assetManager, const bool isHeadless);
 		~SoundLoader();
+
+		SoundHandle Resolve(const string_view resourcePath);
+
+		const Sound* LazyLoadSound(const SoundHandle handle);
 		const Sound* LazyLoadSound(const char* const resourcePath);
 
+		// never touches the audio device, so any thread can call it.
+		// cooked sounds are already decoded, so they're used in place
+		optional<DecodedSound> DecodeWAV(const string& resourcePath) const;
+
+		// hands a sound decoded elsewhere to the device, then unloads it
+		const Sound* InsertDecodedSound(const DecodedSound& decoded);
+
 	private:
-		unordered_map<string, Sound> m_CachedValues = {};
-		const Sound* LoadAndInsert(const char* const resourcePath);
+		// headless sounds are left empty, so playing them does nothing
+		bool m_IsHeadless = false;
+
+		AssetManager* m_AssetManager = nullptr;
+
+		// indexed by handle, and never moved once added
+		std::deque<Sound> m_Sounds = {};
+
+		Sound* GetSound(const SoundHandle handle);
+		optional<Wave> FindArchivedWave(const string_view resourcePath) const;
+		const Sound* LoadAndInsert(const SoundHandle handle);
 	};
 
 	struct MusicLoader
 	{
+		MusicLoader(AssetManager* const assetManager, const bool isHeadless);
 		~MusicLoader();
+
+		MusicHandle Resolve(const string_view resourcePath);
+
+		const Music* LazyLoadMusic(const MusicHandle handle);
 		const Music* LazyLoadMusic(const char* const resourcePath);
 
+		// opens the stream ahead of time, without handing it out.
+		// streams decode as they play, so there's nothing to do off-thread
+		void Preload(const MusicHandle handle);
+
 	private:
-		unordered_map<string, Music> m_CachedValues = {};
-		const Music* LoadAndInsert(const char* const resourcePath);
+		bool m_IsHeadless = false;
+
+		AssetManager* m_AssetManager = nullptr;
+
+		std::deque<Music> m_Music = {};
+
+		Music* GetMusic(const MusicHandle handle);
+		optional<ArchivedAsset> FindArchivedMusic
+			(const string_view resourcePath) const;
+		const Music* LoadAndInsert(const MusicHandle handle);
 	};
 
 	struct MusicLoop
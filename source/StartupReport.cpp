@@ -0,0 +1,104 @@
+#include "StartupReport.h"
+
+#include <algorithm>
+#include <format>
+
+namespace BlastOff
+{
+	namespace
+	{
+		float ToMilliseconds(const uint64_t nanoseconds)
+		{
+			return nanoseconds / 1'000'000.0f;
+		}
+	}
+
+	StartupReport::StartupReport() :
+		m_Start(high_resolution_clock::now())
+	{
+
+	}
+
+	uint64_t StartupReport::CalculateElapsed() const
+	{
+		const auto duration = high_resolution_clock::now() - m_Start;
+		return duration_cast<nanoseconds>(duration).count();
+	}
+
+	void StartupReport::AddPhase(
+		const char* const name, 
+		const uint64_t start, 
+		const bool isOnWorker
+	)
+	{
+		StartupPhase phase = {};
+		phase.name = name;
+		phase.start = start;
+		phase.duration = CalculateElapsed() - start;
+		phase.isOnWorker = isOnWorker;
+
+		const std::lock_guard lock(m_Mutex);
+		m_Phases.push_back(phase);
+	}
+
+	void StartupReport::MarkFrame(const bool isInteractive)
+	{
+		const uint64_t elapsed = CalculateElapsed();
+		if (!m_TimeToFirstFrame)
+			m_TimeToFirstFrame = elapsed;
+		if (isInteractive && !m_TimeToInteractive)
+			m_TimeToInteractive = elapsed;
+	}
+
+	bool StartupReport::IsComplete() const
+	{
+		return m_TimeToInteractive.has_value();
+	}
+
+	float StartupReport::CalculateTimeToFirstFrame() const
+	{
+		return ToMilliseconds(m_TimeToFirstFrame.value_or(0));
+	}
+
+	float StartupReport::CalculateTimeToInteractive() const
+	{
+		return ToMilliseconds(m_TimeToInteractive.value_or(0));
+	}
+
+	vector<string> StartupReport::FormatReport() const
+	{
+		vector<StartupPhase> phases = {};
+		{
+			const std::lock_guard lock(m_Mutex);
+			phases = m_Phases;
+		}
+
+		// in the order they started, so overlapping ones sit together
+		std::sort(
+			phases.begin(),
+			phases.end(),
+			[](const StartupPhase& left, const StartupPhase& right)
+			{
+				return left.start < right.start;
+			}
+		);
+
+		vector<string> result = {};
+		result.push_back(std::format(
+			"first frame after {:.2f} ms, interactive after {:.2f} ms",
+			CalculateTimeToFirstFrame(),
+			CalculateTimeToInteractive()
+		));
+		for (const StartupPhase& phase : phases)
+		{
+			result.push_back(std::format(
+				"{}: {:.2f} ms, from {:.2f} ms, on the {} thread",
+				phase.name,
+				ToMilliseconds(phase.duration),
+				ToMilliseconds(phase.start),
+				phase.isOnWorker ? "worker" : "main"
+			));
+		}
+		return result;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "Utils.h"
+
+#include <mutex>
+
+namespace BlastOff
+{
+	// in nanoseconds, from when the report was constructed
+	struct StartupPhase
+	{
+		const char* name = nullptr;
+		uint64_t start = 0;
+		uint64_t duration = 0;
+
+		// off the main thread, so it only matters 
+		// if the main thread ends up waiting for it
+		bool isOnWorker = false;
+	};
+
+	// times every phase of startup, on whichever thread it ran,
+	// up to the first frame the user can actually interact with
+	struct StartupReport
+	{
+		StartupReport();
+
+		// in nanoseconds
+		uint64_t CalculateElapsed() const;
+
+		// workers time their own phases, so any thread can call this
+		void AddPhase(
+			const char* const name, 
+			const uint64_t start, 
+			const bool isOnWorker
+		);
+
+		// call once a frame. the first frame that isn't a loading
+		// screen is the interactive one, and completes the report
+		void MarkFrame(const bool isInteractive);
+		bool IsComplete() const;
+
+		// in milliseconds, or zero if it hasn't happened yet
+		float CalculateTimeToFirstFrame() const;
+		float CalculateTimeToInteractive() const;
+
+		vector<string> FormatReport() const;
+
+	private:
+		high_resolution_clock::time_point m_Start = {};
+
+		mutable std::mutex m_Mutex;
+		vector<StartupPhase> m_Phases = {};
+
+		optional<uint64_t> m_TimeToFirstFrame = std::nullopt;
+		optional<uint64_t> m_TimeToInteractive = std::nullopt;
+	};
+}
\ No newline at end of file
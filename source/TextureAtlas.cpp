@@ -0,0 +1,87 @@
+#include "TextureAtlas.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace BlastOff
+{
+	AtlasPacker::AtlasPacker(const int atlasSize) :
+		m_AtlasSize(atlasSize)
+	{
+
+	}
+
+	vector<optional<AtlasPlacement>> AtlasPacker::Pack
+		(const vector<Vector2i>& sizes)
+	{
+		const auto sortTallestFirst =
+			[&]() -> vector<size_t>
+			{
+				vector<size_t> result(sizes.size());
+				std::iota(result.begin(), result.end(), 0);
+
+				// stable, so equal images always pack in the same order
+				std::stable_sort(
+					result.begin(),
+					result.end(),
+					[&](const size_t left, const size_t right)
+					{
+						return sizes.at(left).y > sizes.at(right).y;
+					}
+				);
+				return result;
+			};
+
+		vector<optional<AtlasPlacement>> result(sizes.size());
+
+		Vector2i cursor = Vector2i::Zero();
+		int shelfHeight = 0;
+
+		const auto openAtlas =
+			[&, this]()
+			{
+				m_AtlasExtents.push_back(Vector2i::Zero());
+				cursor = Vector2i::Zero();
+				shelfHeight = 0;
+			};
+
+		const auto openShelf =
+			[&]()
+			{
+				cursor = { 0, cursor.y + shelfHeight };
+				shelfHeight = 0;
+			};
+
+		for (const size_t index : sortTallestFirst())
+		{
+			const Vector2i size = sizes.at(index);
+			if ((size.x > m_AtlasSize) || (size.y > m_AtlasSize))
+				continue;
+
+			if (m_AtlasExtents.empty())
+				openAtlas();
+			if ((cursor.x + size.x) > m_AtlasSize)
+				openShelf();
+			if ((cursor.y + size.y) > m_AtlasSize)
+				openAtlas();
+
+			AtlasPlacement placement = {};
+			placement.atlasIndex = m_AtlasExtents.size() - 1;
+			placement.position = cursor;
+			result.at(index) = placement;
+
+			Vector2i& extent = m_AtlasExtents.back();
+			extent.x = std::max(extent.x, cursor.x + size.x);
+			extent.y = std::max(extent.y, cursor.y + size.y);
+
+			cursor.x += size.x;
+			shelfHeight = std::max(shelfHeight, size.y);
+		}
+		return result;
+	}
+
+	const vector<Vector2i>& AtlasPacker::GetAtlasExtents() const
+	{
+		return m_AtlasExtents;
+	}
+}
\ No newline at end of file
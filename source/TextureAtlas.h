@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Utils.h"
+
+namespace BlastOff
+{
+	// where one image ended up, in pixels
+	struct AtlasPlacement
+	{
+		size_t atlasIndex = 0;
+		Vector2i position = Vector2i::Zero();
+	};
+
+	// lays rectangles out on horizontal shelves, tallest first,
+	// and opens another atlas whenever the current one fills up.
+	// it only decides where things go, and never touches pixels
+	struct AtlasPacker
+	{
+		AtlasPacker(const int atlasSize);
+
+		// one result per size, in the same order.
+		// anything too large for an empty atlas is left unplaced
+		vector<optional<AtlasPlacement>> Pack(const vector<Vector2i>& sizes);
+
+		// how far into each atlas anything was placed,
+		// so the atlases can be trimmed down to what they use
+		const vector<Vector2i>& GetAtlasExtents() const;
+
+	private:
+		int m_AtlasSize = 0;
+		vector<Vector2i> m_AtlasExtents = {};
+	};
+}
\ No newline at end of file
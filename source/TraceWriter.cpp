@@ -0,0 +1,160 @@
+#include "TraceWriter.h"
+#include "Logging.h"
+
+namespace BlastOff
+{
+	TraceWriter::TraceWriter(const string& path) :
+		m_Path(path),
+		m_Output(path)
+	{
+		if (!m_Output)
+		{
+			const string message =
+			{
+				"TraceWriter::TraceWriter() failed: "
+				"Unable to open \"" + m_Path + "\" for writing."
+			};
+			Logging::LogWarning(message.c_str());
+			return;
+		}
+
+		m_Output << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+		m_Thread = std::thread([this]() { Run(); });
+	}
+
+	TraceWriter::~TraceWriter()
+	{
+		if (!m_Thread.joinable())
+			return;
+
+		{
+			const std::lock_guard lock(m_Mutex);
+			m_ShouldStop = true;
+		}
+		m_StopCondition.notify_one();
+		m_Thread.join();
+
+		m_Output << "\n]}\n";
+		m_Output.close();
+
+		string message = "Wrote trace to \"" + m_Path + "\".";
+		if (m_DroppedEventCount)
+		{
+			message += 
+				" " + std::to_string(m_DroppedEventCount) + " events "
+				"were overwritten before they could be written.";
+		}
+		Logging::Log(message.c_str());
+	}
+
+	bool TraceWriter::IsOpen() const
+	{
+		return m_Thread.joinable();
+	}
+
+	void TraceWriter::Run()
+	{
+		std::unique_lock lock(m_Mutex);
+		while (!m_ShouldStop)
+		{
+			const auto shouldStop = [this]() { return m_ShouldStop; };
+			m_StopCondition.wait_for(lock, c_FlushInterval, shouldStop);
+
+			lock.unlock();
+			Drain();
+			lock.lock();
+		}
+	}
+
+	void TraceWriter::Drain()
+	{
+		const auto findCursor =
+			[this](const ProfileRingBuffer* const buffer) -> ThreadCursor*
+			{
+				for (ThreadCursor& cursor : m_Cursors)
+				{
+					if (cursor.buffer == buffer)
+						return &cursor;
+				}
+				m_Cursors.push_back({ buffer, 0 });
+				return &m_Cursors.back();
+			};
+
+		for (const ProfileRingBuffer* buffer : Profiler::GetThreadBuffers())
+			DrainBuffer(findCursor(buffer));
+
+		m_Output.flush();
+	}
+
+	void TraceWriter::DrainBuffer(ThreadCursor* const cursor)
+	{
+		constexpr uint64_t capacity = ProfileRingBuffer::c_Capacity;
+		const ProfileRingBuffer* const buffer = cursor->buffer;
+
+		const uint64_t writeCount =
+		{
+			buffer->writeCount.load(std::memory_order_acquire)
+		};
+		if ((writeCount - cursor->readCount) > capacity)
+		{
+			const uint64_t firstAvailable = writeCount - capacity;
+			m_DroppedEventCount += firstAvailable - cursor->readCount;
+			cursor->readCount = firstAvailable;
+		}
+
+		for (; cursor->readCount < writeCount; cursor->readCount++)
+		{
+			const uint64_t index = cursor->readCount;
+			const ProfileEvent event = buffer->events[index % capacity];
+
+			// the owning thread never stops writing, so by the time
+			// an event has been copied, its slot may have been reused
+			const uint64_t latestWriteCount =
+			{
+				buffer->writeCount.load(std::memory_order_acquire)
+			};
+			if ((index + capacity) <= latestWriteCount)
+			{
+				m_DroppedEventCount++;
+				continue;
+			}
+			WriteEvent(event, buffer->threadIndex);
+		}
+	}
+
+	void TraceWriter::WriteEvent(
+		const ProfileEvent& event, 
+		const uint32_t threadIndex
+	)
+	{
+		constexpr double nsPerUs = 1'000;
+
+		StringBuffer buffer;
+		Writer<StringBuffer> writer(buffer);
+
+		// a complete event, with its start and duration in microseconds
+		writer.StartObject();
+		writer.Key("name");
+		writer.String(Profiler::GetZoneName(event.zone));
+		writer.Key("ph");
+		writer.String("X");
+		writer.Key("ts");
+		writer.Double(event.startNs / nsPerUs);
+		writer.Key("dur");
+		writer.Double((event.endNs - event.startNs) / nsPerUs);
+		writer.Key("pid");
+		writer.Uint(0);
+		writer.Key("tid");
+		writer.Uint(threadIndex);
+		writer.EndObject();
+
+		if (m_HasWrittenEvent)
+			m_Output << ",\n";
+
+		m_Output << buffer.GetString();
+		m_HasWrittenEvent = true;
+	}
+
+	// often enough that a ring buffer never fills up in between
+	const milliseconds TraceWriter::c_FlushInterval = milliseconds(50);
+}
\ No newline at end of file
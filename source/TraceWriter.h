@@ -0,0 +1,51 @@
+#pragma once
+
+#include "Utils.h"
+#include "Profiler.h"
+
+#include <condition_variable>
+#include <fstream>
+#include <mutex>
+#include <thread>
+
+namespace BlastOff
+{
+	// streams every profiling zone, from every thread, 
+	// into a Chrome trace-event file, 
+	// which both chrome://tracing and Perfetto can open.
+	//
+	// the file is written on a background thread,
+	// so a frame never waits on the disk
+	struct TraceWriter
+	{
+		TraceWriter(const string& path);
+		~TraceWriter();
+
+		bool IsOpen() const;
+
+	private:
+		struct ThreadCursor
+		{
+			const ProfileRingBuffer* buffer = nullptr;
+			uint64_t readCount = 0;
+		};
+
+		static const milliseconds c_FlushInterval;
+
+		string m_Path;
+		std::ofstream m_Output;
+		bool m_HasWrittenEvent = false;
+		uint64_t m_DroppedEventCount = 0;
+		vector<ThreadCursor> m_Cursors = {};
+
+		std::mutex m_Mutex;
+		std::condition_variable m_StopCondition;
+		bool m_ShouldStop = false;
+		std::thread m_Thread;
+
+		void Run();
+		void Drain();
+		void DrainBuffer(ThreadCursor* const cursor);
+		void WriteEvent(const ProfileEvent& event, const uint32_t threadIndex);
+	};
+}
\ No newline at end of file
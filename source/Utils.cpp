@@ -68,12 +68,6 @@ namespace BlastOff
 		return false;
 	}
 
-	float GetRandomFloat()
-	{
-		constexpr int max = std::numeric_limits<int>::max();
-		return GetRandomValue(0, max) / (float)max;
-	}
-
 	float RoundToFraction(const float num, const float fraction)
 	{
 		return roundf(num  / fraction) * fraction;
@@ -416,6 +410,38 @@ namespace BlastOff
 			(point.x < (*rightEdge));
 	}
 
+	bool Rect2f::CollideWithRect(const Rect2f other) const
+	{
+		const float xDistance = fabsf(x - other.x);
+		const float yDistance = fabsf(y - other.y);
+
+		const float xBoundary = (w + other.w) / 2.0f;
+		const float yBoundary = (h + other.h) / 2.0f;
+		return (xDistance <= xBoundary) && (yDistance <= yBoundary);
+	}
+
+	optional<Rect2f> Rect2f::Intersect(const Rect2f other) const
+	{
+		const Vector2f halfSize = GetSize() / 2.0f;
+		const Vector2f otherHalfSize = other.GetSize() / 2.0f;
+
+		const float left = std::max(x - halfSize.x, other.x - otherHalfSize.x);
+		const float right = std::min(x + halfSize.x, other.x + otherHalfSize.x);
+		const float bottom = std::max(y - halfSize.y, other.y - otherHalfSize.y);
+		const float top = std::min(y + halfSize.y, other.y + otherHalfSize.y);
+
+		if ((left >= right) || (bottom >= top))
+			return std::nullopt;
+
+		const Vector2f position = 
+		{ 
+			(left + right) / 2.0f, 
+			(bottom + top) / 2.0f 
+		};
+		const Vector2f size = { right - left, top - bottom };
+		return Rect2f(position, size);
+	}
+
 	Rect2i Rect2f::ToRect2i() const
 	{
 		return Rect2i
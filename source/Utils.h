@@ -166,7 +166,6 @@ namespace BlastOff
 
 	bool StringContains(const char* const string, const char value);
 
-	float GetRandomFloat();
 	float RoundToFraction(const float num, const float fraction);
 	float FloorToFraction(const float num, const float fraction);
 	
@@ -819,6 +818,10 @@ namespace BlastOff
 
 		bool CollideWithLine(const Line2f line) const;
 		bool CollideWithPoint(const Vector2f point) const;
+		bool CollideWithRect(const Rect2f other) const;
+
+		// the part of this rect that's also inside the other
+		optional<Rect2f> Intersect(const Rect2f other) const;
 
 		Rect2i ToRect2i() const;
 
@@ -911,7 +914,8 @@ namespace BlastOff
 
 		constexpr Rect2f CalculateBoundingBox() const
 		{
-			return Rect2f(position, { radius, radius });
+			const float diameter = radius * 2;
+			return Rect2f(position, { diameter, diameter });
 		}
 
 		bool CollideWithPoint(const Vector2f point) const;
@@ -938,6 +942,22 @@ namespace BlastOff
 		return Lerp(a.ToVector2f(), b.ToVector2f(), t);
 	}
 
+	constexpr Colour4i Lerp(const Colour4i a, const Colour4i b, const float t)
+	{
+		const auto lerpChannel =
+			[&](const byte first, const byte second) -> byte
+			{
+				return (byte)(Lerp(first, second, t) + 0.5f);
+			};
+
+		return Colour4i(
+			lerpChannel(a.r, b.r),
+			lerpChannel(a.g, b.g),
+			lerpChannel(a.b, b.b),
+			lerpChannel(a.a, b.a)
+		);
+	}
+
 	constexpr Vector2f DirectionToVector2f(const Direction direction)
 	{
 		switch (direction)
@@ -0,0 +1,97 @@
+#include "VerticalIndex.h"
+#include "Logging.h"
+
+#include <algorithm>
+
+namespace BlastOff
+{
+	VerticalIndex::VerticalIndex(
+		const float bottom,
+		const float top,
+		const float bucketHeight
+	)
+	{
+		Reset(bottom, top, bucketHeight);
+	}
+
+	void VerticalIndex::Reset
+		(const float bottom, const float top, const float bucketHeight)
+	{
+		m_Bottom = bottom;
+		m_BucketHeight = bucketHeight;
+		m_ItemCount = 0;
+
+		for (vector<size_t>& bucket : m_Buckets)
+			bucket.clear();
+
+		const size_t bucketCount = 
+		{
+			std::max((size_t)ceilf((top - bottom) / bucketHeight), (size_t)1)
+		};
+		m_Buckets.resize(bucketCount);
+	}
+
+	void VerticalIndex::Insert
+		(const size_t item, const float bottom, const float top)
+	{
+		if (m_Buckets.empty())
+		{
+			const char* const message =
+			{
+				"VerticalIndex::Insert() failed: "
+				"The index was default-constructed, and has no buckets."
+			};
+			Logging::LogWarning(message);
+			return;
+		}
+
+		const size_t first = FindBucket(bottom);
+		const size_t last = FindBucket(top);
+		for (size_t index = first; index <= last; index++)
+			m_Buckets.at(index).push_back(item);
+
+		m_ItemCount++;
+	}
+
+	const vector<size_t>& VerticalIndex::Query
+		(const float bottom, const float top)
+	{
+		m_QueryResult.clear();
+		if (m_Buckets.empty())
+			return m_QueryResult;
+
+		const size_t first = FindBucket(bottom);
+		const size_t last = FindBucket(top);
+		for (size_t index = first; index <= last; index++)
+		{
+			const vector<size_t>& bucket = m_Buckets.at(index);
+			m_QueryResult.insert(
+				m_QueryResult.end(), 
+				bucket.begin(), 
+				bucket.end()
+			);
+		}
+
+		// anything spanning several buckets shows up once for each,
+		// and callers expect the order things were inserted in
+		std::sort(m_QueryResult.begin(), m_QueryResult.end());
+		const auto end = std::unique(m_QueryResult.begin(), m_QueryResult.end());
+		m_QueryResult.erase(end, m_QueryResult.end());
+
+		return m_QueryResult;
+	}
+
+	size_t VerticalIndex::GetItemCount() const
+	{
+		return m_ItemCount;
+	}
+
+	size_t VerticalIndex::FindBucket(const float height) const
+	{
+		const float offset = (height - m_Bottom) / m_BucketHeight;
+		if (offset <= 0)
+			return 0;
+
+		return std::min((size_t)offset, m_Buckets.size() - 1);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "Utils.h"
+
+namespace BlastOff
+{
+	// splits a range of heights into equal buckets, 
+	// so whatever is near a given height can be found 
+	// without checking everything in the world.
+	// items are the caller's own indices, and never move once inserted
+	struct VerticalIndex
+	{
+		VerticalIndex() = default;
+		VerticalIndex(
+			const float bottom, 
+			const float top, 
+			const float bucketHeight
+		);
+
+		// empties the index and gives it a new range,
+		// keeping each bucket's capacity
+		void Reset(
+			const float bottom, 
+			const float top, 
+			const float bucketHeight
+		);
+
+		// anything outside the indexed range 
+		// goes into the nearest end bucket
+		void Insert(const size_t item, const float bottom, const float top);
+
+		// every item whose span might overlap the given one, 
+		// in ascending order, without repeats. 
+		// the result is only valid until the next query
+		const vector<size_t>& Query(const float bottom, const float top);
+
+		size_t GetItemCount() const;
+
+	private:
+		float m_Bottom = 0;
+		float m_BucketHeight = 1;
+		size_t m_ItemCount = 0;
+
+		vector<vector<size_t>> m_Buckets = {};
+
+		// reused, so queries don't allocate once it's grown
+		vector<size_t> m_QueryResult = {};
+
+		size_t FindBucket(const float height) const;
+	};
+}
\ No newline at end of file